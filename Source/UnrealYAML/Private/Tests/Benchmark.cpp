@@ -0,0 +1,369 @@
+﻿// Copyright (c) 2021-2026, Forschungszentrum Jülich GmbH. All rights reserved.
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "Misc/AutomationTest.h"
+#include "YamlParsing.h"
+#include "YamlPath.h"
+#include "eventhandler.h"
+#include "HAL/PlatformMemory.h"
+#include "node/detail/node.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+// A Document with many small Maps, Sequences and Scalars of different styles
+std::string MakeBenchmarkYaml(const int32 Entries) {
+    std::string Yaml;
+    for (int32 i = 0; i < Entries; i++) {
+        const std::string Index = std::to_string(i);
+        Yaml += "entry" + Index + ":\n";
+        Yaml += "  name: \"Entry number " + Index + " with a quoted description\"\n";
+        Yaml += "  plain: a plain scalar that goes on for a while " + Index + " # and a comment\n";
+        Yaml += "  value: " + std::to_string(i * 0.25) + "\n";
+        Yaml += "  tags: [first, second, third" + Index + "]\n";
+        Yaml += "  block: |\n    line one " + Index + "\n    line two\n";
+    }
+    return Yaml;
+}
+
+// Number of Nodes in the Tree, Keys included
+int64 CountNodes(const YAML::Node& Node) {
+    int64 Count = 1;
+    for (const auto& Entry : Node) {
+        Count += Node.IsMap() ? CountNodes(Entry.first) + CountNodes(Entry.second) : CountNodes(Entry);
+    }
+    return Count;
+}
+
+// Consumes all Events, so only the Scanner and Parser are measured
+class FNullEventHandler final : public YAML::EventHandler {
+public:
+    virtual void OnDocumentStart(const YAML::Mark&) override {}
+    virtual void OnDocumentEnd() override {}
+    virtual void OnNull(const YAML::Mark&, YAML::anchor_t) override {}
+    virtual void OnAlias(const YAML::Mark&, YAML::anchor_t) override {}
+    virtual void OnScalar(const YAML::Mark&, const std::string&, YAML::anchor_t, const std::string&) override {}
+    virtual void OnSequenceStart(const YAML::Mark&, const std::string&, YAML::anchor_t, YAML::EmitterStyle) override {}
+    virtual void OnSequenceEnd() override {}
+    virtual void OnMapStart(const YAML::Mark&, const std::string&, YAML::anchor_t, YAML::EmitterStyle) override {}
+    virtual void OnMapEnd() override {}
+};
+}
+
+
+#if ENGINE_MAJOR_VERSION >= 5
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkTokenizer, "UnrealYAML.Benchmark.Tokenizer",
+                                 EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#else
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkTokenizer, "UnrealYAML.Benchmark.Tokenizer",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#endif
+
+bool BenchmarkTokenizer::RunTest(const FString& Parameters) {
+    const std::string Yaml = MakeBenchmarkYaml(20000);
+    constexpr int32 Runs = 5;
+
+    FNullEventHandler Handler;
+    const double Start = FPlatformTime::Seconds();
+    for (int32 Run = 0; Run < Runs; Run++) {
+        YAML::Parser Parser(Yaml.data(), Yaml.size());
+        TestTrue("Document is parsed", Parser.HandleNextDocument(Handler));
+    }
+    const double Seconds = (FPlatformTime::Seconds() - Start) / Runs;
+
+    AddInfo(FString::Printf(TEXT("Tokenized %.2f MB in %.2f ms (%.1f MB/s)"), Yaml.size() / 1e6, Seconds * 1e3,
+                            Yaml.size() / 1e6 / Seconds));
+    return !HasAnyErrors();
+}
+
+
+#if ENGINE_MAJOR_VERSION >= 5
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkLoadAll, "UnrealYAML.Benchmark.LoadAll",
+                                 EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#else
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkLoadAll, "UnrealYAML.Benchmark.LoadAll",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#endif
+
+bool BenchmarkLoadAll::RunTest(const FString& Parameters) {
+    // Many small Documents, like an exported Stat Table
+    std::string Yaml;
+    for (int32 i = 0; i < 50000; i++) {
+        Yaml += "---\nid: " + std::to_string(i) + "\nname: \"Entry " + std::to_string(i) + "\"\nvalues: [1, 2, 3]\n";
+    }
+    const TArrayView<const uint8> Bytes(reinterpret_cast<const uint8*>(Yaml.data()), static_cast<int32>(Yaml.size()));
+
+    double Start = FPlatformTime::Seconds();
+    const std::vector<YAML::Node> Sequential = YAML::LoadAll(Yaml.data(), Yaml.size());
+    const double SequentialSeconds = FPlatformTime::Seconds() - Start;
+
+    TArray<FYamlNode> Parallel;
+    Start = FPlatformTime::Seconds();
+    TestTrue("Documents are parsed", UYamlParsing::ParseAllYaml(Bytes, Parallel));
+    const double ParallelSeconds = FPlatformTime::Seconds() - Start;
+
+    TestEqual("Document Count", Parallel.Num(), static_cast<int32>(Sequential.size()));
+    AddInfo(FString::Printf(TEXT("Loaded %d Documents in %.2f ms sequentially and %.2f ms in parallel"),
+                            Parallel.Num(), SequentialSeconds * 1e3, ParallelSeconds * 1e3));
+    return !HasAnyErrors();
+}
+
+
+
+#if ENGINE_MAJOR_VERSION >= 5
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkMapLookup, "UnrealYAML.Benchmark.MapLookup",
+                                 EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#else
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkMapLookup, "UnrealYAML.Benchmark.MapLookup",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#endif
+
+bool BenchmarkMapLookup::RunTest(const FString& Parameters) {
+    // Many small Records, like a Table of Gameplay Stats
+    const std::string Yaml = MakeBenchmarkYaml(2000);
+    FYamlNode Records;
+    TestTrue("Document is parsed", UYamlParsing::ParseYaml(std::string_view(Yaml), Records));
+    constexpr int32 Runs = 20;
+    int32 Found = 0;
+
+    const FString NameString(TEXT("name"));
+    const FString ValueString(TEXT("value"));
+    double Start = FPlatformTime::Seconds();
+    for (int32 Run = 0; Run < Runs; Run++) {
+        for (const auto [Key, Record] : AsConst(Records)) {
+            Found += Record[NameString].IsDefined() + Record[ValueString].IsDefined();
+        }
+    }
+    const double StringSeconds = FPlatformTime::Seconds() - Start;
+
+    static const FYamlKey NameKey(TEXT("name"));
+    static const FYamlKey ValueKey(TEXT("value"));
+    Start = FPlatformTime::Seconds();
+    for (int32 Run = 0; Run < Runs; Run++) {
+        for (const auto [Key, Record] : AsConst(Records)) {
+            Found += Record[NameKey].IsDefined() + Record[ValueKey].IsDefined();
+        }
+    }
+    const double KeySeconds = FPlatformTime::Seconds() - Start;
+
+    TestEqual("All Keys are found", Found, Records.Size() * Runs * 4);
+    AddInfo(FString::Printf(TEXT("Looked up %d Keys in %.2f ms with FString and %.2f ms with FYamlKey"),
+                            Records.Size() * Runs * 2, StringSeconds * 1e3, KeySeconds * 1e3));
+    return !HasAnyErrors();
+}
+
+
+
+#if ENGINE_MAJOR_VERSION >= 5
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkAssemble, "UnrealYAML.Benchmark.Assemble",
+                                 EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#else
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkAssemble, "UnrealYAML.Benchmark.Assemble",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#endif
+
+bool BenchmarkAssemble::RunTest(const FString& Parameters) {
+    // Every Level wraps the Tree built so far, like nested Structs during Serialization
+    constexpr int32 Levels = 4000;
+
+    const double Start = FPlatformTime::Seconds();
+    FYamlNode Tree(TArray<int32>{1, 2, 3});
+    for (int32 i = 0; i < Levels; i++) {
+        FYamlNode Outer;
+        Outer["level"] = i;
+        Outer["inner"] = Tree;
+        Tree.Reset(Outer);
+    }
+    const double Seconds = FPlatformTime::Seconds() - Start;
+
+    TestEqual("Outermost Level", Tree["level"].As<int32>(), Levels - 1);
+    AddInfo(FString::Printf(TEXT("Assembled %d Levels in %.2f ms"), Levels, Seconds * 1e3));
+    return !HasAnyErrors();
+}
+
+
+
+#if ENGINE_MAJOR_VERSION >= 5
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkMemory, "UnrealYAML.Benchmark.Memory",
+                                 EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#else
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkMemory, "UnrealYAML.Benchmark.Memory",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#endif
+
+bool BenchmarkMemory::RunTest(const FString& Parameters) {
+    const std::string Yaml = MakeBenchmarkYaml(20000);
+
+    const uint64 Before = FPlatformMemory::GetStats().UsedPhysical;
+    const YAML::Node Document = YAML::Load(Yaml);
+    const int64 Used = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(Before);
+
+    const int64 Nodes = CountNodes(Document);
+    TestTrue("Document is parsed", Document.IsMap() && Nodes > 0);
+
+    // Physical Memory is only a rough Measure, other Threads allocate as well
+    AddInfo(FString::Printf(TEXT("%lld Nodes of %.2f MB Text use about %.2f MB (%.0f Bytes per Node)"), Nodes,
+                            Yaml.size() / 1e6, Used / 1e6, static_cast<double>(Used) / Nodes));
+    AddInfo(FString::Printf(TEXT("sizeof: node %d, node_ref %d, node_data %d"),
+                            static_cast<int32>(sizeof(YAML::detail::node)),
+                            static_cast<int32>(sizeof(YAML::detail::node_ref)),
+                            static_cast<int32>(sizeof(YAML::detail::node_data))));
+    return !HasAnyErrors();
+}
+
+
+
+#if ENGINE_MAJOR_VERSION >= 5
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkClone, "UnrealYAML.Benchmark.Clone",
+                                 EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#else
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkClone, "UnrealYAML.Benchmark.Clone",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#endif
+
+bool BenchmarkClone::RunTest(const FString& Parameters) {
+    const YAML::Node Document = YAML::Load(MakeBenchmarkYaml(20000));
+
+    double Start = FPlatformTime::Seconds();
+    const YAML::Node Copy = YAML::Clone(Document);
+    const double CloneSeconds = FPlatformTime::Seconds() - Start;
+
+    Start = FPlatformTime::Seconds();
+    const YAML::Node Unshared = YAML::CloneUnshared(Document);
+    const double UnsharedSeconds = FPlatformTime::Seconds() - Start;
+
+    const int64 Nodes = CountNodes(Document);
+    TestEqual("Clone Nodes", CountNodes(Copy), Nodes);
+    TestEqual("CloneUnshared Nodes", CountNodes(Unshared), Nodes);
+    AddInfo(FString::Printf(TEXT("Cloned %lld Nodes in %.2f ms, without Aliases in %.2f ms"), Nodes,
+                            CloneSeconds * 1e3, UnsharedSeconds * 1e3));
+    return !HasAnyErrors();
+}
+
+
+
+#if ENGINE_MAJOR_VERSION >= 5
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkIterate, "UnrealYAML.Benchmark.Iterate",
+                                 EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#else
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkIterate, "UnrealYAML.Benchmark.Iterate",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#endif
+
+bool BenchmarkIterate::RunTest(const FString& Parameters) {
+    FYamlNode Sequence(EYamlNodeType::Sequence);
+    for (int32 i = 0; i < 100000; i++) {
+        Sequence.Push(i);
+    }
+
+    int64 IteratorSum = 0;
+    double Start = FPlatformTime::Seconds();
+    for (const auto& Entry : Sequence) {
+        IteratorSum += Entry.Key.As<int32>() + Entry.Value.As<int32>();
+    }
+    const double IteratorSeconds = FPlatformTime::Seconds() - Start;
+
+    int64 ViewSum = 0;
+    Start = FPlatformTime::Seconds();
+    for (const auto [Index, Value] : Sequence.Elements()) {
+        ViewSum += Index + Value.As<int32>();
+    }
+    const double ViewSeconds = FPlatformTime::Seconds() - Start;
+
+    TestEqual("Elements visits every Element", ViewSum, IteratorSum);
+    AddInfo(FString::Printf(TEXT("Iterated %d Elements in %.2f ms with begin()/end(), in %.2f ms with Elements()"),
+                            Sequence.Size(), IteratorSeconds * 1e3, ViewSeconds * 1e3));
+    return !HasAnyErrors();
+}
+
+
+
+#if ENGINE_MAJOR_VERSION >= 5
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkPath, "UnrealYAML.Benchmark.Path",
+                                 EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#else
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkPath, "UnrealYAML.Benchmark.Path",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#endif
+
+bool BenchmarkPath::RunTest(const FString& Parameters) {
+    FYamlNode Node;
+    const std::string Yaml = MakeBenchmarkYaml(1000);
+    TestTrue("Document is parsed", UYamlParsing::ParseYaml(std::string_view(Yaml), Node));
+    const FYamlNode Root = Node;
+    constexpr int32 Lookups = 100000;
+
+    int64 IndexSum = 0;
+    double Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Lookups; i++) {
+        IndexSum += Root["entry765"]["tags"][2].Scalar().Len();
+    }
+    const double IndexSeconds = FPlatformTime::Seconds() - Start;
+
+    const FYamlPath Path(TEXT("entry765.tags[2]"));
+    int64 PathSum = 0;
+    Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Lookups; i++) {
+        PathSum += Path.Resolve(Root).Scalar().Len();
+    }
+    const double PathSeconds = FPlatformTime::Seconds() - Start;
+
+    const FYamlPath CachedPath(TEXT("entry765.tags[2]"), true);
+    int64 CachedSum = 0;
+    Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Lookups; i++) {
+        CachedSum += CachedPath.Resolve(Root).Scalar().Len();
+    }
+    const double CachedSeconds = FPlatformTime::Seconds() - Start;
+
+    TestEqual("Path finds the same Value", PathSum, IndexSum);
+    TestEqual("Cached Path finds the same Value", CachedSum, IndexSum);
+    AddInfo(FString::Printf(TEXT("%d Lookups took %.2f ms with operator[], %.2f ms with FYamlPath, %.2f ms cached"),
+                            Lookups, IndexSeconds * 1e3, PathSeconds * 1e3, CachedSeconds * 1e3));
+    return !HasAnyErrors();
+}
+
+
+
+#if ENGINE_MAJOR_VERSION >= 5
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkNumbers, "UnrealYAML.Benchmark.Numbers",
+                                 EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#else
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BenchmarkNumbers, "UnrealYAML.Benchmark.Numbers",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+#endif
+
+bool BenchmarkNumbers::RunTest(const FString& Parameters) {
+    // Keyframes of a Curve, as Time, Value and Index
+    std::string Yaml;
+    for (int32 i = 0; i < 100000; i++) {
+        Yaml += "- [" + std::to_string(i / 30.0) + ", " + std::to_string(FMath::Sin(i * 0.01)) + ", " +
+                std::to_string(i) + "]\n";
+    }
+    FYamlNode Parsed;
+    UYamlParsing::ParseYaml(std::string_view(Yaml), Parsed);
+    const FYamlNode Node = Parsed;
+
+    double Sum = 0;
+    double Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Node.Size(); i++) {
+        const FYamlNode Key = Node[i];
+        Sum += Key[0].As<float>() + Key[1].As<double>() + Key[2].As<int32>();
+    }
+    const double DecodeSeconds = FPlatformTime::Seconds() - Start;
+
+    FYamlNode Encoded(EYamlNodeType::Sequence);
+    Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Node.Size(); i++) {
+        Encoded.Push(i / 30.0);
+    }
+    const double EncodeSeconds = FPlatformTime::Seconds() - Start;
+
+    TestTrue("Numbers are decoded", Sum > 0);
+    AddInfo(FString::Printf(TEXT("Decoded %d Numbers in %.2f ms, encoded %d in %.2f ms"), Node.Size() * 3,
+                            DecodeSeconds * 1e3, Encoded.Size(), EncodeSeconds * 1e3));
+    return !HasAnyErrors();
+}
+
+
+#endif
@@ -0,0 +1,123 @@
+﻿// Copyright (c) 2021-2026, Forschungszentrum Jülich GmbH. All rights reserved.
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "YamlDocument.h"
+#include "YamlKey.h"
+#include "YamlNode.h"
+#include "YamlParsing.h"
+#include "Inputs.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#if ENGINE_MAJOR_VERSION >= 5
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(Document, "UnrealYAML.Document",
+                                 EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+#else
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(Document, "UnrealYAML.Document",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+#endif
+
+bool Document::RunTest(const FString& Parameters) {
+    // Parsing
+    {
+        FYamlDocument Document;
+        TestTrue("Parse Empty", FYamlDocument::Parse(EmptyYaml, Document));
+        TestFalse("Empty has no Root", Document.Root().IsValid());
+        TestTrue("Parse Simple", FYamlDocument::Parse(SimpleYaml, Document));
+        TestEqual("Simple Nodes", Document.Num(), 18);
+        TestFalse("Parse Erroneous", FYamlDocument::Parse(ErroneousYaml, Document));
+        TestEqual("Erroneous is empty", Document.Num(), 0);
+
+        const FTCHARToUTF8 Utf8(*SimpleYaml);
+        TestTrue("Parse UTF-8", FYamlDocument::Parse(FUtf8StringView(Utf8.Get(), Utf8.Length()), Document));
+        TestEqual("Parse UTF-8 Content", Document.Root()["int"].Scalar(), FString(TEXT("42")));
+
+        const FString Path = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("Document.yml"));
+        FFileHelper::SaveStringToFile(ComplexYaml, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+        TestTrue("Load File", FYamlDocument::LoadFromFile(Path, Document));
+        TestTrue("Load File Content", Document.Root()["mixed"].IsSequence());
+        TestFalse("Load Missing File", FYamlDocument::LoadFromFile(Path + TEXT(".missing"), Document));
+        IFileManager::Get().Delete(*Path);
+    }
+
+    // Navigation
+    {
+        FYamlDocument Document;
+        FYamlDocument::Parse(SimpleYaml, Document);
+        const FYamlCursor Root = Document.Root();
+
+        TestTrue("Root is Map", Root.IsMap());
+        TestEqual("Root Size", Root.Size(), 5);
+        TestEqual("Scalar", Root["str"].Scalar(), FString(TEXT("A String")));
+        TestTrue("Scalar View", Root[FUtf8StringView(UTF8TEXT("str"))].GetScalar() == UTF8TEXT("A String"));
+        TestEqual("Key ignores Case", Root["INT"].Scalar(), FString(TEXT("42")));
+        TestFalse("UTF-8 Key respects Case", Root[FUtf8StringView(UTF8TEXT("INT"))].IsValid());
+        TestEqual("FYamlKey", Root[FYamlKey(TEXT("Bool"))].Scalar(), FString(TEXT("true")));
+        TestEqual("Sequence Size", Root["arr"].Size(), 3);
+        TestEqual("Sequence Element", Root["arr"][2].Scalar(), FString(TEXT("3")));
+        TestEqual("Nested Map", Root["map"]["b"].Scalar(), FString(TEXT("2")));
+
+        TestFalse("Missing Key", Root["missing"].IsValid());
+        TestFalse("Out of Range", Root["arr"][3].IsValid());
+        TestFalse("Index into Map", Root[0].IsValid());
+        TestFalse("Navigate from invalid", Root["missing"]["deeper"][0].IsValid());
+        TestEqual("Invalid Type", Root["missing"].Type(), EYamlNodeType::Undefined);
+
+        // Keys and Values alternate and Containers are skipped as a whole
+        FString Keys;
+        for (FYamlCursor Key = Root.First(); Key.IsValid(); Key = Key.Next().Next()) {
+            Keys += Key.Scalar() + TEXT(" ");
+        }
+        TestEqual("Iterate Keys", Keys, FString(TEXT("str int bool arr map ")));
+    }
+
+    // Nulls, Tags and Aliases
+    {
+        FYamlDocument Document;
+        FYamlDocument::Parse(TEXT("base: &base {a: 1}\ncopy: *base\nnone: ~\ntagged: !custom value"), Document);
+        const FYamlCursor Root = Document.Root();
+
+        TestTrue("Null", Root["none"].IsNull());
+        TestTrue("Tag", Root["tagged"].GetTag() == UTF8TEXT("!custom"));
+        TestEqual("Alias", Root["copy"]["a"].Scalar(), FString(TEXT("1")));
+        TestEqual("Alias Next", Root.First().Next().Next().Next().Next().Scalar(), FString(TEXT("none")));
+    }
+
+    // Conversion into Nodes
+    {
+        FYamlDocument Document;
+        FYamlDocument::Parse(ComplexYaml, Document);
+
+        const FYamlNode Node = Document.Root().ToNode();
+        TestEqual("Node nested Array", Node["nested"][1].As<TArray<FString>>(), TArray<FString>{"a", "b", "c", "d"});
+        TestTrue("Node Null", Node["nested"][2].IsNull());
+        TestTrue("Node Color", Node["struct"]["color"].As<FColor>() == FColor::Magenta);
+        TestEqual("Part to Node", Document.Root()["nested"][0].ToNode().As<TArray<int>>(), {1, 2, 3});
+
+        FYamlDocument::Parse(TEXT("base: &base [1, 2]\nfirst: *base\nsecond: *base"), Document);
+        TestEqual("Alias to Node", Document.Root().ToNode()["second"].As<TArray<int>>(), {1, 2});
+        TestEqual("Alias outside of Part", Document.Root()["first"].ToNode().As<TArray<int>>(), {1, 2});
+    }
+
+    // Smaller than the Node Graph
+    {
+        FString Yaml;
+        for (int32 i = 0; i < 1000; i++) {
+            Yaml += FString::Printf(TEXT("- {id: %d, name: Entry %d}\n"), i, i);
+        }
+
+        FYamlDocument Document;
+        FYamlDocument::Parse(Yaml, Document);
+        TestEqual("Large Document", Document.Root()[765]["name"].Scalar(), FString(TEXT("Entry 765")));
+        TestTrue("Large Document Size", Document.GetAllocatedSize() < static_cast<SIZE_T>(Document.Num()) * 32);
+    }
+
+    return !HasAnyErrors();
+}
+
+
+#endif
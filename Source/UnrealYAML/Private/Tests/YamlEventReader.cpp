@@ -0,0 +1,224 @@
+﻿// Copyright (c) 2021-2026, Forschungszentrum Jülich GmbH. All rights reserved.
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "YamlEventReader.h"
+#include "YamlNode.h"
+#include "Inputs.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+// Records the Events as a compact String, optionally stopping after a number of Scalars
+class FRecordingHandler final : public IYamlEventHandler {
+public:
+    FString Events;
+    FString Error;
+    int32 ScalarLimit = MAX_int32;
+
+    virtual bool OnDocumentStart(const FYamlMark& Mark) override {
+        Events += TEXT("+DOC ");
+        return true;
+    }
+
+    virtual bool OnDocumentEnd() override {
+        Events += TEXT("-DOC ");
+        return true;
+    }
+
+    virtual bool OnNull(const FYamlMark& Mark, uint64 Anchor) override {
+        Events += TEXT("~ ");
+        return true;
+    }
+
+    virtual bool OnAlias(const FYamlMark& Mark, uint64 Anchor) override {
+        Events += FString::Printf(TEXT("*%llu "), Anchor);
+        return true;
+    }
+
+    virtual bool OnAnchor(const FYamlMark& Mark, FUtf8StringView Name) override {
+        Events += FString::Printf(TEXT("&%s "), *FYamlEventReader::ToString(Name));
+        return true;
+    }
+
+    virtual bool OnScalar(const FYamlMark& Mark, FUtf8StringView Tag, uint64 Anchor, FUtf8StringView Value) override {
+        Events += FYamlEventReader::ToString(Value) + TEXT(" ");
+        return --ScalarLimit > 0;
+    }
+
+    virtual bool OnSequenceStart(const FYamlMark& Mark, FUtf8StringView Tag, uint64 Anchor,
+                                 EYamlEmitterStyle Style) override {
+        Events += TEXT("[ ");
+        return true;
+    }
+
+    virtual bool OnSequenceEnd() override {
+        Events += TEXT("] ");
+        return true;
+    }
+
+    virtual bool OnMapStart(const FYamlMark& Mark, FUtf8StringView Tag, uint64 Anchor,
+                            EYamlEmitterStyle Style) override {
+        Events += TEXT("{ ");
+        return true;
+    }
+
+    virtual bool OnMapEnd() override {
+        Events += TEXT("} ");
+        return true;
+    }
+
+    virtual void OnError(const FYamlMark& Mark, const FString& Message) override {
+        Error = FString::Printf(TEXT("%d:%d %s"), Mark.Line, Mark.Column, *Message);
+    }
+};
+}
+
+
+#if ENGINE_MAJOR_VERSION >= 5
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(EventReader, "UnrealYAML.EventReader",
+                                 EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+#else
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(EventReader, "UnrealYAML.EventReader",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+#endif
+
+bool EventReader::RunTest(const FString& Parameters) {
+    const FString Expected = TEXT("+DOC { str A String int 42 bool true arr [ 1 2 3 ] map { a 1 b 2 } } -DOC ");
+
+    // From String
+    {
+        FRecordingHandler Handler;
+        TestTrue("Read Simple", FYamlEventReader::Read(SimpleYaml, Handler) == EYamlReadResult::Finished);
+        TestEqual("Read Simple Events", Handler.Events, Expected);
+
+        FRecordingHandler Multiple;
+        const EYamlReadResult Result = FYamlEventReader::Read(TEXT("a: &x 1\nb: *x\n---\n- ~\n"), Multiple);
+        TestTrue("Read Documents", Result == EYamlReadResult::Finished);
+        TestEqual("Read Documents Events", Multiple.Events,
+                  FString(TEXT("+DOC { a &x 1 b *1 } -DOC +DOC [ ~ ] -DOC ")));
+    }
+
+    // From UTF-8
+    {
+        const FTCHARToUTF8 Utf8(*SimpleYaml);
+
+        FRecordingHandler Handler;
+        const EYamlReadResult Result = FYamlEventReader::Read(FUtf8StringView(Utf8.Get(), Utf8.Length()), Handler);
+        TestTrue("Read UTF-8", Result == EYamlReadResult::Finished);
+        TestEqual("Read UTF-8 Events", Handler.Events, Expected);
+    }
+
+    // Early Abort
+    {
+        FRecordingHandler Handler;
+        Handler.ScalarLimit = 2;
+        TestTrue("Abort", FYamlEventReader::Read(SimpleYaml, Handler) == EYamlReadResult::Aborted);
+        TestEqual("Abort Events", Handler.Events, FString(TEXT("+DOC { str A String ")));
+    }
+
+    // Errors
+    {
+        FRecordingHandler Handler;
+        TestTrue("Read Erroneous", FYamlEventReader::Read(ErroneousYaml, Handler) == EYamlReadResult::Failed);
+        TestFalse("Read Erroneous Message", Handler.Error.IsEmpty());
+    }
+
+    // From File
+    {
+        const FString Path = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("Events.yml"));
+        FFileHelper::SaveStringToFile(SimpleYaml, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+
+        FRecordingHandler Handler;
+        TestTrue("Read File", FYamlEventReader::ReadFile(Path, Handler) == EYamlReadResult::Finished);
+        TestEqual("Read File Events", Handler.Events, Expected);
+
+        FRecordingHandler Missing;
+        const EYamlReadResult Result = FYamlEventReader::ReadFile(Path + TEXT(".missing"), Missing);
+        TestTrue("Read Missing File", Result == EYamlReadResult::Failed);
+    }
+
+    // Pushed in Chunks
+    {
+        const FTCHARToUTF8 Utf8(*(SimpleYaml + TEXT("---\n- a\n- b\n...\n---\nlast\n")));
+        const TArrayView<const uint8> Bytes(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+
+        FRecordingHandler Handler;
+        FYamlPushParser Events(Handler);
+        for (int32 i = 0; i < Bytes.Num(); i += 5) {
+            TestTrue("Push Chunk", Events.Feed(Bytes.Slice(i, FMath::Min(5, Bytes.Num() - i))));
+        }
+        TestEqual("Push Open Document", Handler.Events, Expected + TEXT("+DOC [ a b ] -DOC "));
+        TestTrue("Push Finish", Events.Finish() == EYamlReadResult::Finished);
+        TestEqual("Push Events", Handler.Events, Expected + TEXT("+DOC [ a b ] -DOC +DOC last -DOC "));
+
+        TArray<FYamlNode> Documents;
+        FYamlPushParser Nodes([&Documents](const FYamlNode& Document) { Documents.Add(Document); });
+        TestTrue("Push Nodes", Nodes.Feed(Bytes) && Nodes.Finish() == EYamlReadResult::Finished);
+        TestEqual("Push Nodes Count", Documents.Num(), 3);
+        if (Documents.Num() == 3) {
+            TestEqual("Push Nodes Content", Documents[0]["int"].As<int32>(), 42);
+            TestEqual("Push Nodes Last", Documents[2].As<FString>(), FString(TEXT("last")));
+        }
+
+        // Marks are Positions in the whole Input, not in the Document
+        TArray<FYamlNode> Marked;
+        FYamlPushParser MarkedNodes([&Marked](const FYamlNode& Document) { Marked.Add(Document); });
+        const char* MarkedYaml = "a: 1\n---\nb: 2\nc: 3\n";
+        const TArrayView<const uint8> MarkedBytes(reinterpret_cast<const uint8*>(MarkedYaml),
+                                                  FCStringAnsi::Strlen(MarkedYaml));
+        TestTrue("Push Marks", MarkedNodes.Feed(MarkedBytes) && MarkedNodes.Finish() == EYamlReadResult::Finished);
+        TestEqual("Push Marks Count", Marked.Num(), 2);
+        if (Marked.Num() == 2) {
+            const FYamlMark Mark = Marked[1]["c"].Mark();
+            TestTrue("Push Marks in second Document", Mark.Position == 17 && Mark.Line == 3 && Mark.Column == 3);
+        }
+
+        // Directives apply to all later Documents, as when parsing the whole Input at once
+        TArray<FYamlNode> Tagged;
+        FYamlPushParser TaggedNodes([&Tagged](const FYamlNode& Document) { Tagged.Add(Document); });
+        const char* TaggedYaml = "%TAG !e! tag:example.com,2000:\n--- !e!a 1\n--- !e!b 2\n";
+        const TArrayView<const uint8> TaggedBytes(reinterpret_cast<const uint8*>(TaggedYaml),
+                                                  FCStringAnsi::Strlen(TaggedYaml));
+        for (int32 i = 0; i < TaggedBytes.Num(); i += 5) {
+            TaggedNodes.Feed(TaggedBytes.Slice(i, FMath::Min(5, TaggedBytes.Num() - i)));
+        }
+        TestTrue("Push Directives", TaggedNodes.Finish() == EYamlReadResult::Finished);
+        TestEqual("Push Directives Count", Tagged.Num(), 2);
+        if (Tagged.Num() == 2) {
+            TestEqual("Push Directives first Tag", Tagged[0].Tag(), FString(TEXT("tag:example.com,2000:a")));
+            TestEqual("Push Directives second Tag", Tagged[1].Tag(), FString(TEXT("tag:example.com,2000:b")));
+        }
+
+        // Only a "..." in front of all Documents ends an empty one, as when parsing the whole Input at once
+        struct FCase {
+            const char* Input;
+            int32 Count;
+        };
+        for (const FCase& Case : {FCase{"a: 1\n...\n...\n", 1}, FCase{"a: 1\n...\n# comment\n...\nb: 2\n...\n", 2},
+                                  FCase{"...\n", 1}}) {
+            int32 Pushed = 0;
+            FYamlPushParser Counter([&Pushed](const FYamlNode&) { Pushed++; });
+            const TArrayView<const uint8> Input(reinterpret_cast<const uint8*>(Case.Input),
+                                                FCStringAnsi::Strlen(Case.Input));
+            TestTrue("Push repeated Document End",
+                     Counter.Feed(Input) && Counter.Finish() == EYamlReadResult::Finished);
+            TestEqual("Push repeated Document End Count", Pushed, Case.Count);
+        }
+
+        FYamlPushParser Erroneous([](const FYamlNode&) {});
+        const FTCHARToUTF8 ErroneousUtf8(*(ErroneousYaml + TEXT("\n---\n")));
+        const TArrayView<const uint8> ErroneousBytes(reinterpret_cast<const uint8*>(ErroneousUtf8.Get()),
+                                                     ErroneousUtf8.Length());
+        TestFalse("Push Erroneous", Erroneous.Feed(ErroneousBytes));
+        TestTrue("Push Erroneous Result", Erroneous.Finish() == EYamlReadResult::Failed);
+        TestFalse("Push Erroneous Message", Erroneous.GetError().IsEmpty());
+    }
+
+    return !HasAnyErrors();
+}
+
+
+#endif
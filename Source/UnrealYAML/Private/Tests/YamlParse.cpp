@@ -2,9 +2,16 @@
 // Licensed under the MIT License. See LICENSE file for details.
 
 #include "Misc/AutomationTest.h"
+#include "Async/ParallelFor.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
 #include "YamlParsing.h"
+#include "YamlPath.h"
 #include "Inputs.h"
 
+#include <atomic>
+
 #if WITH_DEV_AUTOMATION_TESTS
 
 // For Engine Versions <5
@@ -12,6 +19,21 @@
 #define UE_PI PI
 #endif
 
+// A Type whose Decoder throws instead of reporting failure, like many hand-written ones
+struct FThrowingDecoded {
+    int32 Value = 0;
+};
+
+namespace YAML {
+template<>
+struct convert<FThrowingDecoded> {
+    static bool decode(const Node& Node, FThrowingDecoded& Out) {
+        Out.Value = Node["x"].as<int32>();
+        return true;
+    }
+};
+}
+
 #if ENGINE_MAJOR_VERSION >= 5
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(Parsing, "UnrealYAML.Parsing",
                                  EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
@@ -30,6 +52,94 @@ bool Parsing::RunTest(const FString& Parameters) {
         TestFalse("Parse Erroneous", UYamlParsing::ParseYaml(ErroneousYaml, Node));
     }
 
+    // From UTF-8
+    {
+        const FTCHARToUTF8 Utf8(*SimpleYaml);
+        const TArray<uint8> Bytes(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+
+        FYamlNode Node;
+        TestTrue("Parse UTF-8 View", UYamlParsing::ParseYaml(FUtf8StringView(Utf8.Get(), Utf8.Length()), Node));
+        TestEqual("Parse UTF-8 View Content", Node["int"].As<int32>(), 42);
+        TestTrue("Parse Bytes", UYamlParsing::ParseYaml(MakeArrayView(Bytes), Node));
+        TestEqual("Parse Bytes Content", Node["str"].As<FString>(), "A String");
+        TestTrue("Parse std::string_view", UYamlParsing::ParseYaml(std::string_view("key: \xc3\xa4"), Node));
+        TestEqual("Parse std::string_view Content", Node["key"].As<FString>(), FString(TEXT("\u00e4")));
+        TestFalse("Parse Erroneous Bytes", UYamlParsing::ParseYaml(std::string_view("err: -"), Node));
+    }
+
+    // From File
+    {
+        const FString Path = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("Simple.yml"));
+        FFileHelper::SaveStringToFile(SimpleYaml, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+
+        FYamlNode Node;
+        FYamlFileLoadStats Stats;
+        TestTrue("Load File", UYamlParsing::LoadYamlFromFile(Path, Node, Stats));
+        TestEqual("Load File Content", Node["int"].As<int32>(), 42);
+        TestEqual("Load File Bytes", Stats.BytesMapped + Stats.BytesCopied, IFileManager::Get().FileSize(*Path));
+        TestFalse("Load Missing File", UYamlParsing::LoadYamlFromFile(Path + TEXT(".missing"), Node));
+
+        IFileManager::Get().Delete(*Path);
+    }
+
+    // Asynchronously
+    {
+        const FYamlParseResult Parsed = UYamlParsing::ParseYamlAsync(SimpleYaml).Get();
+        TestTrue("Parse Async", Parsed.HasValue());
+        if (Parsed.HasValue()) {
+            TestEqual("Parse Async Content", Parsed.GetValue()["int"].As<int32>(), 42);
+        }
+
+        const FYamlParseResult Erroneous = UYamlParsing::ParseYamlAsync(ErroneousYaml).Get();
+        TestTrue("Parse Async Erroneous", Erroneous.HasError() && !Erroneous.GetError().IsEmpty());
+
+        const FString Path = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("Async.yml"));
+        FFileHelper::SaveStringToFile(SimpleYaml, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+
+        const FYamlParseResult Loaded = UYamlParsing::LoadYamlFromFileAsync(Path).Get();
+        TestTrue("Load Async", Loaded.HasValue());
+        if (Loaded.HasValue()) {
+            TestEqual("Load Async Content", Loaded.GetValue()["str"].As<FString>(), "A String");
+        }
+
+        const FYamlParseResult Missing = UYamlParsing::LoadYamlFromFileAsync(Path + TEXT(".missing")).Get();
+        TestTrue("Load Async Missing File", Missing.HasError());
+
+        IFileManager::Get().Delete(*Path);
+    }
+
+    // All Documents
+    {
+        // Large enough to be split over several Tasks
+        FString Stream;
+        for (int32 i = 0; i < 5000; i++) {
+            Stream += FString::Printf(TEXT("---\nid: %d\nname: Entry %d\n"), i, i);
+        }
+
+        TArray<FYamlNode> Documents;
+        TestTrue("Parse All", UYamlParsing::ParseAllYaml(Stream, Documents));
+        TestEqual("Parse All Count", Documents.Num(), 5000);
+        if (Documents.Num() == 5000) {
+            TestEqual("Parse All First", Documents[0]["id"].As<int32>(), 0);
+            TestEqual("Parse All Order", Documents[4321]["name"].As<FString>(), FString(TEXT("Entry 4321")));
+        }
+
+        TestTrue("Parse All Single", UYamlParsing::ParseAllYaml(SimpleYaml, Documents) && Documents.Num() == 1);
+        TestFalse("Parse All Erroneous", UYamlParsing::ParseAllYaml(Stream + TEXT("---\n") + ErroneousYaml, Documents));
+
+        // "..." Lines and Comments after a large Document stay with it
+        for (const char* Tail : {"...\n...\nb: 2\n", "...\n# comment\n...\nb: 2\n", "...\n\n...\n"}) {
+            std::string Yaml;
+            for (int32 i = 0; i < 3000; i++) {
+                Yaml += "key" + std::to_string(i) + ": value\n";
+            }
+            Yaml += Tail;
+            const TArrayView<const uint8> Bytes(reinterpret_cast<const uint8*>(Yaml.data()), static_cast<int32>(Yaml.size()));
+            TestTrue("Parse All after Document End", UYamlParsing::ParseAllYaml(Bytes, Documents));
+            TestEqual("Parse All after Document End Count", Documents.Num(), static_cast<int32>(YAML::LoadAll(Yaml).size()));
+        }
+    }
+
     // Simple
     {
         FYamlNode Node;
@@ -43,6 +153,54 @@ bool Parsing::RunTest(const FString& Parameters) {
                                          .OrderIndependentCompareEqual(TMap<FString, int32>{{"a", 1}, {"b", 2}}));
     }
 
+    // Conversions that may fail
+    {
+        FYamlNode Node;
+        UYamlParsing::ParseYaml("int: 42\nstr: text\nmixed: [1, two]\nvec: [1, 2, 3]", Node);
+
+        int32 Int = -1;
+        TestTrue("TryAs", Node["int"].TryAs(Int) && Int == 42);
+        Int = -1;
+        TestFalse("TryAs fails", Node["str"].TryAs(Int));
+        TestEqual("TryAs keeps Value", Int, -1);
+
+        TArray<int32> Array;
+        TestFalse("TryAs fails on nested Value", Node["mixed"].TryAs(Array));
+        TestFalse("TryAs fails on missing Value", Node["missing"].TryAs(Int));
+
+        FVector Vector;
+        TestTrue("TryAs Vector", Node["vec"].TryAs(Vector) && Vector == FVector(1, 2, 3));
+        TestFalse("CanConvertTo fails on nested Value", Node["mixed"].CanConvertTo<TArray<int32>>());
+
+        FYamlNode Custom;
+        UYamlParsing::ParseYaml("good: {x: 1}\nbad: {x: text}", Custom);
+        TestEqual("As with throwing Decoder", Custom["good"].As<FThrowingDecoded>().Value, 1);
+        TestEqual("As with failing throwing Decoder", Custom["bad"].As<FThrowingDecoded>().Value, 0);
+        TestFalse("AsOptional with failing throwing Decoder", Custom["bad"].AsOptional<FThrowingDecoded>().IsSet());
+        TestFalse("CanConvertTo with failing throwing Decoder", Custom["bad"].CanConvertTo<FThrowingDecoded>());
+    }
+
+    // Numbers
+    {
+        FYamlNode Node;
+        UYamlParsing::ParseYaml("hex: 0x1F\noct: 017\nneg: -42\nbig: 300\nfloat: -1.5e3\ninf: -.inf\nnan: .NaN", Node);
+
+        TestEqual("Hexadecimal", Node["hex"].As<int32>(), 31);
+        TestEqual("Octal", Node["oct"].As<int32>(), 15);
+        TestFalse("Unsigned rejects negative Values", Node["neg"].CanConvertTo<uint32>());
+        TestFalse("Out of range", Node["big"].CanConvertTo<uint8>());
+        TestFalse("Floats are no Integers", Node["float"].CanConvertTo<int32>());
+        TestEqual("Float", Node["float"].As<double>(), -1500.0);
+        TestTrue("Infinity", Node["inf"].As<float>() < -TNumericLimits<float>::Max());
+        TestTrue("NaN", FMath::IsNaN(Node["nan"].As<double>()));
+
+        TestEqual("Byte is a Number", FYamlNode(static_cast<uint8>(200)).As<uint8>(), static_cast<uint8>(200));
+        TestEqual("Integer Limit", FYamlNode(MIN_int64).As<int64>(), MIN_int64);
+        for (const double Value : {1.0 / 3.0, 6.02214076e23, -4.9e-324, 123456.789}) {
+            TestTrue("Round Trip is exact", FYamlNode(Value).As<double>() == Value);
+        }
+    }
+
     // FName
     {
         FYamlNode Node;
@@ -51,6 +209,319 @@ bool Parsing::RunTest(const FString& Parameters) {
         TestEqual("Parse Name", Node["name"].As<FName>(), FName("TestName"));
     }
 
+    // String Keys
+    {
+        FYamlNode Node;
+        UYamlParsing::ParseYaml("myInteger: 42\nname: \xc3\xa4", Node);
+
+        TestEqual("FString Key", Node[FString(TEXT("myInteger"))].As<int32>(), 42);
+        TestEqual("FString Key ignores Case", Node[FString(TEXT("MyInteger"))].As<int32>(), 42);
+        TestEqual("FName Key", Node[FName(TEXT("MyInteger"))].As<int32>(), 42);
+        TestEqual("FUtf8StringView Key", Node[FUtf8StringView(UTF8TEXT("myInteger"))].As<int32>(), 42);
+        TestFalse("FUtf8StringView Key respects Case", Node.Find(FUtf8StringView(UTF8TEXT("MyInteger"))).IsSet());
+        TestEqual("std::string_view Key", Node[std::string_view("name")].As<FString>(), FString(TEXT("\u00e4")));
+
+        const FYamlKey Key(TEXT("MyInteger"));
+        TestEqual("FYamlKey", Node[Key].As<int32>(), 42);
+        TestTrue("Find FYamlKey", Node.Find(Key).IsSet());
+        TestFalse("Find missing Key", Node.Find(FYamlKey(TEXT("missing"))).IsSet());
+        TestEqual("Find does not insert", Node.Size(), 2);
+    }
+
+    // Scalar Views
+    {
+        FYamlNode Node;
+        UYamlParsing::ParseYaml("tag: Enemy.Boss\nname: \xc3\xa4\nlist: [a]", Node);
+
+        TestTrue("ScalarView", Node["tag"].ScalarView().Equals(UTF8TEXT("Enemy.Boss")));
+        TestTrue("ScalarUtf8", Node["tag"].ScalarUtf8() == std::string_view("Enemy.Boss"));
+        TestTrue("ScalarView is empty for other Types", Node["list"].ScalarView().IsEmpty());
+        TestEqual("Scalar decodes UTF-8", Node["name"].Scalar(), FString(TEXT("\u00e4")));
+
+        TestTrue("ScalarEquals", Node["tag"].ScalarEquals(TEXT("Enemy.Boss")));
+        TestFalse("ScalarEquals respects Case", Node["tag"].ScalarEquals(TEXT("enemy.boss")));
+        TestTrue("ScalarEquals ignores Case", Node["tag"].ScalarEquals(TEXT("enemy.BOSS"), ESearchCase::IgnoreCase));
+        TestTrue("ScalarEquals UTF-8", Node["name"].ScalarEquals(TEXT("\u00e4")));
+        TestTrue("ScalarEquals FUtf8StringView", Node["tag"].ScalarEquals(FUtf8StringView(UTF8TEXT("Enemy.Boss"))));
+        TestFalse("ScalarEquals on a Sequence", Node["list"].ScalarEquals(TEXT("")));
+        const FYamlNode& Const = Node;
+        TestFalse("ScalarEquals on a missing Node", Const["missing"].ScalarEquals(TEXT("")));
+
+        for (const auto [Index, Value] : Node["list"].Elements()) {
+            TestTrue("ScalarEquals on FYamlNodeRef", Value.ScalarEquals(TEXT("A"), ESearchCase::IgnoreCase));
+        }
+    }
+
+    // Large Maps are looked up through an Index
+    {
+        FString Yaml;
+        for (int32 i = 0; i < 1000; i++) {
+            Yaml += FString::Printf(TEXT("key%d: %d\n"), i, i);
+        }
+
+        FYamlNode Node;
+        UYamlParsing::ParseYaml(Yaml, Node);
+        TestEqual("Large Map Lookup", Node["key765"].As<int32>(), 765);
+        TestEqual("Large Map FYamlKey", Node[FYamlKey(TEXT("KEY42"))].As<int32>(), 42);
+
+        Node.Remove("key765");
+        TestFalse("Large Map Remove", Node["key765"].IsDefined());
+        TestEqual("Large Map Lookup after Remove", Node["key999"].As<int32>(), 999);
+
+        Node["key1000"] = 1000;
+        TestEqual("Large Map Insert", Node["key1000"].As<int32>(), 1000);
+        TestEqual("Large Map Size", Node.Size(), 1000);
+
+        // Keys renamed through another Document, which the Map was inserted into, still invalidate its Index
+        FYamlNode Outer;
+        UYamlParsing::ParseYaml("inner: ~", Outer);
+        Outer["inner"] = Node;
+        for (auto Entry : Outer["inner"]) {
+            if (Entry.Key.Scalar() == TEXT("key10")) {
+                Entry.Key = FString(TEXT("renamed"));
+                break;
+            }
+        }
+        TestEqual("Large Map Lookup of renamed Key", Node["renamed"].As<int32>(), 10);
+        TestFalse("Large Map Lookup of old Key", Node["key10"].IsDefined());
+    }
+
+    // Deep Copies
+    {
+        FYamlNode Node;
+        UYamlParsing::ParseYaml("a: &x {k: [1, 2]}\nb: *x\nc: !t tagged", Node);
+
+        FYamlNode Copy = Node.Clone();
+        TestEqual("Clone keeps Tags", Copy["c"].Tag(), FString(TEXT("!t")));
+        Copy["a"]["k"][0] = 9;
+        TestEqual("Clone is independent", Node["a"]["k"][0].As<int32>(), 1);
+        TestEqual("Clone preserves Aliases", Copy["b"]["k"][0].As<int32>(), 9);
+
+        FYamlNode Unshared = Node.Clone(false);
+        Unshared["a"]["k"][0] = 9;
+        TestEqual("Unshared Clone copies Aliases", Unshared["b"]["k"][0].As<int32>(), 1);
+
+        // Every Level of nested Aliases would multiply the Copies by ten, to 10^9 Nodes in the End
+        FString Laughs = TEXT("l0: &l0 [a, b, c, d, e, f, g, h, i, j]\n");
+        for (int32 Level = 1; Level < 9; Level++) {
+            Laughs += FString::Printf(TEXT("l%d: &l%d ["), Level, Level);
+            for (int32 i = 0; i < 10; i++) {
+                Laughs += FString::Printf(TEXT("%s*l%d"), i > 0 ? TEXT(", ") : TEXT(""), Level - 1);
+            }
+            Laughs += TEXT("]\n");
+        }
+        FYamlNode Nested;
+        UYamlParsing::ParseYaml(Laughs, Nested);
+        const FYamlNode Bounded = Nested.Clone(false);
+        TestTrue("Unshared Clone of nested Aliases is bounded", Bounded.GetMemoryStats().Nodes < 1000);
+        TestTrue("Unshared Clone of nested Aliases shares them", Bounded["l8"][0].Is(Bounded["l8"][1]));
+    }
+
+    // Iteration Views
+    {
+        FYamlNode Node;
+        UYamlParsing::ParseYaml("seq: [1, 2, three]\nmap: {a: 1, b: [5, 6]}", Node);
+
+        int32 Sum = 0;
+        int32 Count = 0;
+        for (const auto [Index, Value] : Node["seq"].Elements()) {
+            TestEqual("Elements Index", Index, Count++);
+            Sum += Value.As<int32>();
+        }
+        TestEqual("Elements", Count, 3);
+        TestEqual("Elements Values", Sum, 3);
+
+        TArray<FString> Keys;
+        for (const auto [Key, Value] : Node["map"].Pairs()) {
+            Keys.Add(Key.Scalar());
+        }
+        TestEqual("Pairs", Keys, TArray<FString>{TEXT("a"), TEXT("b")});
+
+        Count = 0;
+        for (const auto Element : Node["map"].Elements()) {
+            Count++;
+        }
+        for (const auto Pair : Node["seq"].Pairs()) {
+            Count++;
+        }
+        TestEqual("Views are empty for other Types", Count, 0);
+
+        Sum = 0;
+        for (const auto [Index, Value] : Node["map"]["b"].Elements()) {
+            Sum += Index * Value.As<int32>();
+        }
+        Node["map"].ForEachPair([&Sum](const FYamlNodeRef Key, const FYamlNodeRef Value) {
+            for (const auto [Index, Element] : Value.Elements()) {
+                Sum += Element.As<int32>();
+            }
+        });
+        TestEqual("Nested Views", Sum, 17);
+
+        TArray<FYamlNode> Kept;
+        Node["seq"].ForEachElement([&Kept](const int32 Index, const FYamlNodeRef Value) {
+            Kept.Add(Value.ToNode());
+        });
+        TestTrue("ToNode", Kept.Num() == 3 && Kept[2].Is(Node["seq"][2]));
+
+        // The Arrow Operators must not point to a destroyed Pair, and a postfix Increment steps once
+        const FYamlPairs MapPairs = Node["map"].Pairs();
+        TestEqual("Pairs Arrow", MapPairs.begin()->Key.Scalar(), FString(TEXT("a")));
+
+        FYamlNode Map = Node["map"];
+        auto Entry = Map.begin();
+        TestEqual("Iterator Arrow", Entry->Key.Scalar(), FString(TEXT("a")));
+        const auto Previous = Entry++;
+        TestEqual("Postfix Increment returns the previous Position", Previous->Key.Scalar(), FString(TEXT("a")));
+        TestEqual("Postfix Increment advances", Entry->Key.Scalar(), FString(TEXT("b")));
+
+        FYamlNode Sequence = Node["seq"];
+        auto Element = Sequence.begin();
+        Element++;
+        TestEqual("Postfix Increment advances the Index once", Element.Key().As<int32>(), 1);
+    }
+
+    // Paths
+    {
+        FYamlNode Node;
+        UYamlParsing::ParseYaml("levels:\n"
+                                "  - name: first\n"
+                                "  - name: boss level\n"
+                                "    spawns:\n"
+                                "      boss: {hp: 500, type: dragon}\n"
+                                "      minion: {hp: 10, type: goblin}\n"
+                                "'a.b': dotted", Node);
+
+        const FYamlPath Hp(TEXT("levels[1].spawns.boss.hp"));
+        TestTrue("Path is valid", Hp.IsValid());
+        TestEqual("Path", Hp.Resolve(Node).As<int32>(), 500);
+        TestEqual("Path ignores Case", FYamlPath(TEXT("Levels[-1].Spawns.Minion.HP")).Resolve(Node).As<int32>(), 10);
+        TestEqual("Path with quoted Key", FYamlPath(TEXT("['a.b']")).Resolve(Node).Scalar(), FString(TEXT("dotted")));
+        TestFalse("Path to missing Key", FYamlPath(TEXT("levels[0].spawns.boss")).Find(Node).IsSet());
+        TestFalse("Path does not insert", Node["levels"][0]["spawns"].IsDefined());
+
+        TestEqual("Path with Wildcard", FYamlPath(TEXT("levels[*].name")).FindAll(Node).Num(), 2);
+        TestEqual("Path with Filter", FYamlPath(TEXT("levels[1].spawns[?type=goblin].hp")).Resolve(Node).As<int32>(), 10);
+        TestEqual("Path with negated Filter",
+                  FYamlPath(TEXT("levels[1].spawns[?type != 'goblin'].hp")).Resolve(Node).As<int32>(), 500);
+        TestEqual("Path with Key Filter", FYamlPath(TEXT("levels[?spawns].name")).Resolve(Node).Scalar(),
+                  FString(TEXT("boss level")));
+
+        const FYamlPath Invalid(TEXT("levels[1"));
+        TestFalse("Invalid Path", Invalid.IsValid());
+        TestFalse("Invalid Path has an Error", Invalid.GetError().IsEmpty());
+        TestFalse("Invalid Path matches nothing", Invalid.Find(Node).IsSet());
+
+        const FYamlPath Cached(TEXT("levels[1].spawns[*].hp"), true);
+        TestEqual("Cached Path", Cached.FindAll(Node).Num(), 2);
+        Node["levels"][1]["spawns"]["extra"]["hp"] = 1;
+        TestEqual("Cached Path after Insert", Cached.FindAll(Node).Num(), 3);
+        Node["levels"][1]["spawns"]["boss"]["hp"] = 400;
+        TestEqual("Cached Path after Assignment", Cached.Resolve(Node).As<int32>(), 400);
+        Node["levels"][1]["spawns"].Remove("boss");
+        TestEqual("Cached Path after Remove", Cached.FindAll(Node).Num(), 2);
+
+        FYamlNode First, Second;
+        UYamlParsing::ParseYaml("value: 1", First);
+        UYamlParsing::ParseYaml("value: 2\nother: 3", Second);
+        const FYamlNode FrozenFirst = First.Freeze();
+        const FYamlPath Value(TEXT("value"), true);
+        TestEqual("Cached Path in first Root", Value.Resolve(First).As<int32>(), 1);
+        TestEqual("Cached Path in second Root", Value.Resolve(Second).As<int32>(), 2);
+        TestEqual("Cached Path in frozen Root", Value.Resolve(FrozenFirst).As<int32>(), 1);
+        TestEqual("Cached Path after frozen Root", Value.Resolve(Second).As<int32>(), 2);
+        TestTrue("Cached Path keeps first Root", First.Size() == 1 && First["value"].As<int32>() == 1);
+        TestTrue("Cached Path keeps second Root", Second.Size() == 2 && Second["value"].As<int32>() == 2);
+        TestTrue("Cached Path keeps frozen Root", FrozenFirst.Size() == 1 && FrozenFirst["value"].As<int32>() == 1);
+
+        // Documents count their Modifications separately, also after one was inserted into another
+        FYamlNode Parent;
+        UYamlParsing::ParseYaml("child: ~", Parent);
+        Parent["child"] = First;
+        TestEqual("Cached Path after Insert into other Document", Value.Resolve(First).As<int32>(), 1);
+        Parent["child"]["value"] = 5;
+        TestEqual("Cached Path after Assignment through other Document", Value.Resolve(First).As<int32>(), 5);
+    }
+
+    // Frozen Snapshots are read from many Threads
+    {
+        FString Yaml;
+        for (int32 i = 0; i < 100; i++) {
+            Yaml += FString::Printf(TEXT("key%d: [%d, %d]\n"), i, i, i * 2);
+        }
+
+        FYamlNode Node;
+        UYamlParsing::ParseYaml(Yaml, Node);
+        const FYamlNode Frozen = Node.Freeze();
+        TestTrue("Frozen", Frozen.IsFrozen() && Frozen["key1"].IsFrozen());
+        TestFalse("Original not Frozen", Node.IsFrozen());
+
+        std::atomic<int32> Mismatches{0};
+        ParallelFor(64, [&](const int32 Task) {
+            FYamlNode Local = Frozen;
+            for (int32 i = 0; i < 100; i++) {
+                const FYamlNode Value = Local[FString::Printf(TEXT("key%d"), (i + Task) % 100)];
+                if (Value.Size() != 2 || Value[1].As<int32>() != (i + Task) % 100 * 2 || Local["missing"].IsDefined()) {
+                    ++Mismatches;
+                }
+            }
+        });
+        TestEqual("Read Frozen from Threads", Mismatches.load(), 0);
+        TestEqual("Frozen does not insert", Frozen.Size(), 100);
+
+        // the Snapshot is only referenced by the Trees it is assigned to
+        ParallelFor(64, [&](const int32 Task) {
+            const FYamlNode Local = Frozen;
+            FYamlNode Out(EYamlNodeType::Map);
+            Out["cfg"] = Local;
+            Out["part"] = Local[FString::Printf(TEXT("key%d"), Task)];
+            FYamlNode Sequence(EYamlNodeType::Sequence);
+            Sequence.Push(Local["key1"]);
+            if (Out["cfg"].Size() != 100 || Out["part"][0].As<int32>() != Task || Sequence[0][1].As<int32>() != 2) {
+                ++Mismatches;
+            }
+        });
+        TestEqual("Assign Frozen from Threads", Mismatches.load(), 0);
+
+        Node["key2"] = 0;
+        TestEqual("Frozen is a Copy", Frozen["key2"][0].As<int32>(), 2);
+        TestEqual("Original is modified", Node["key2"].As<int32>(), 0);
+    }
+
+    // Nodes outlive the Documents they were parsed from
+    {
+        FYamlNode Node, Kept;
+        {
+            FYamlNode First, Second;
+            UYamlParsing::ParseYaml(SimpleYaml, First);
+            UYamlParsing::ParseYaml("key: value", Second);
+
+            Node["arr"] = First["arr"];
+            Node["second"] = Second;
+            Second["key"] = First["str"];
+
+            // Kept Nodes still refer to Memory that was merged into another one, possibly several times
+            Kept = Second["key"];
+            FYamlNode Outer;
+            Outer["node"] = Node;
+        }
+
+        TestEqual("Merged Array", Node["arr"].As<TArray<int>>(), {1, 2, 3});
+        TestEqual("Merged Scalar", Node["second"]["key"].As<FString>(), "A String");
+        TestEqual("Kept Scalar", Kept.As<FString>(), "A String");
+    }
+
+    // Memory Stats
+    {
+        FYamlNode Node;
+        UYamlParsing::ParseYaml("a: 1\nb: [2, 3]", Node);
+
+        const FYamlMemoryStats Stats = Node.GetMemoryStats();
+        TestEqual("Memory Stats Nodes", Stats.Nodes, int64(7));
+        TestEqual("Memory Stats Scalars", Stats.ScalarBytes, int64(5));
+        TestTrue("Memory Stats Allocated", Stats.AllocatedBytes > Stats.ScalarBytes + Stats.ContainerBytes);
+        TestEqual("Memory Stats cover the Document", Node["b"].GetMemoryStats().Nodes, Stats.Nodes);
+    }
+
     {
         FYamlNode Node;
         UYamlParsing::ParseYaml(ComplexYaml, Node);
@@ -2,5 +2,47 @@
 // Licensed under the MIT License. See LICENSE file for details.
 
 #include "Modules/ModuleManager.h"
+#include "Containers/Ticker.h"
+#include "YamlStats.h"
+#include "yaml.h"
 
-IMPLEMENT_MODULE(FDefaultModuleImpl, UnrealYAML)
+DEFINE_STAT(STAT_YamlLiveNodes);
+DEFINE_STAT(STAT_YamlNodeMemory);
+
+LLM_DEFINE_TAG(UnrealYAML);
+
+// The thread-safe Ticker replaced FTicker in UE5
+#if ENGINE_MAJOR_VERSION >= 5
+using FYamlStatsTicker = FTSTicker;
+using FYamlStatsTickerHandle = FTSTicker::FDelegateHandle;
+#else
+using FYamlStatsTicker = FTicker;
+using FYamlStatsTickerHandle = FDelegateHandle;
+#endif
+
+
+class FUnrealYAMLModule final : public FDefaultModuleImpl {
+public:
+    virtual void StartupModule() override {
+#if STATS
+        // The Totals are kept by yaml-cpp, which knows nothing about Stats, so they are copied over once per Frame
+        StatsTicker = FYamlStatsTicker::GetCoreTicker().AddTicker(TEXT("UnrealYAML Stats"), 0.0f, [](float) {
+            const YAML::MemoryStats Totals = YAML::GetTotalMemoryStats();
+            SET_DWORD_STAT(STAT_YamlLiveNodes, Totals.nodes);
+            SET_MEMORY_STAT(STAT_YamlNodeMemory, Totals.allocatedBytes);
+            return true;
+        });
+#endif
+    }
+
+    virtual void ShutdownModule() override {
+#if STATS
+        FYamlStatsTicker::GetCoreTicker().RemoveTicker(StatsTicker);
+#endif
+    }
+
+private:
+    FYamlStatsTickerHandle StatsTicker;
+};
+
+IMPLEMENT_MODULE(FUnrealYAMLModule, UnrealYAML)
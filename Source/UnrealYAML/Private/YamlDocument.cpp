@@ -0,0 +1,396 @@
+﻿// Copyright (c) 2021-2026, Forschungszentrum Jülich GmbH. All rights reserved.
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "YamlDocument.h"
+
+#include "YamlKey.h"
+#include "YamlNode.h"
+#include "YamlStats.h"
+#include "yaml.h"
+#include "eventhandler.h"
+#include "nodebuilder.h"
+#include "Misc/FileHelper.h"
+
+#include <cstring>
+#include <unordered_map>
+
+
+// Appends the Events of the first Document to the Tape
+class FYamlTapeBuilder final : public YAML::EventHandler {
+public:
+    explicit FYamlTapeBuilder(FYamlDocument& InDocument) :
+        Document(InDocument) {
+        Document.Tape.Reset();
+        Document.Strings.Reset();
+        Document.Tags.Reset();
+        Document.Tags.Emplace();
+    }
+
+    void Finish() {
+        Document.Tape.Shrink();
+        Document.Strings.Shrink();
+    }
+
+    virtual void OnDocumentStart(const YAML::Mark&) override {}
+    virtual void OnDocumentEnd() override {}
+
+    virtual void OnNull(const YAML::Mark&, const YAML::anchor_t Anchor) override {
+        Add(FYamlTapeEntry::EKind::Null, std::string(), Anchor);
+    }
+
+    virtual void OnAlias(const YAML::Mark&, const YAML::anchor_t Anchor) override {
+        const uint32 Target = Anchors[Anchor];
+        const uint32 Index = Add(FYamlTapeEntry::EKind::Alias, std::string(), YAML::NullAnchor);
+        Document.Tape[Index].Offset = Target;
+        Document.Tape[Target].bAnchored = true;
+    }
+
+    virtual void OnScalar(const YAML::Mark&, const std::string& Tag, const YAML::anchor_t Anchor,
+                          const std::string& Value) override {
+        const uint32 Index = Add(FYamlTapeEntry::EKind::Scalar, Tag, Anchor);
+        Document.Tape[Index].Offset = Document.Strings.Num();
+        Document.Tape[Index].Size = Value.size();
+        Document.Strings.Append(reinterpret_cast<const UTF8CHAR*>(Value.data()), Value.size());
+    }
+
+    virtual void OnSequenceStart(const YAML::Mark&, const std::string& Tag, const YAML::anchor_t Anchor,
+                                 const YAML::EmitterStyle Style) override {
+        Open(FYamlTapeEntry::EKind::Sequence, Tag, Anchor, Style);
+    }
+
+    virtual void OnSequenceEnd() override {
+        Close();
+    }
+
+    virtual void OnMapStart(const YAML::Mark&, const std::string& Tag, const YAML::anchor_t Anchor,
+                            const YAML::EmitterStyle Style) override {
+        Open(FYamlTapeEntry::EKind::Map, Tag, Anchor, Style);
+    }
+
+    virtual void OnMapEnd() override {
+        // Keys and Values were counted separately
+        Document.Tape[Close()].Size /= 2;
+    }
+
+private:
+    uint32 Add(const FYamlTapeEntry::EKind Kind, const std::string& Tag, const YAML::anchor_t Anchor) {
+        if (OpenEntries.Num()) {
+            Document.Tape[OpenEntries.Last()].Size++;
+        }
+
+        const uint32 Index = Document.Tape.AddDefaulted();
+        Document.Tape[Index].Kind = Kind;
+        Document.Tape[Index].Tag = TagIndex(Tag);
+
+        if (Anchor != YAML::NullAnchor) {
+            if (Anchors.Num() <= static_cast<int32>(Anchor)) {
+                Anchors.SetNumZeroed(static_cast<int32>(Anchor) + 1);
+            }
+            Anchors[Anchor] = Index;
+        }
+        return Index;
+    }
+
+    void Open(const FYamlTapeEntry::EKind Kind, const std::string& Tag, const YAML::anchor_t Anchor,
+              const YAML::EmitterStyle Style) {
+        const uint32 Index = Add(Kind, Tag, Anchor);
+        Document.Tape[Index].Style = static_cast<EYamlEmitterStyle>(Style);
+        OpenEntries.Push(Index);
+    }
+
+    uint32 Close() {
+        const uint32 Index = OpenEntries.Last();
+        OpenEntries.RemoveAt(OpenEntries.Num() - 1, 1, false);
+        Document.Tape[Index].Offset = Document.Tape.Num();
+        return Index;
+    }
+
+    uint32 TagIndex(const std::string& Tag) {
+        if (Tag.empty()) {
+            return 0;
+        }
+
+        const auto [Iterator, bAdded] = TagIndices.emplace(Tag, Document.Tags.Num());
+        if (bAdded) {
+            Document.Tags.Add(Tag);
+        }
+        return Iterator->second;
+    }
+
+    FYamlDocument& Document;
+    TArray<uint32> OpenEntries;
+    TArray<uint32> Anchors;
+    std::unordered_map<std::string, uint32> TagIndices;
+};
+
+
+namespace {
+uint32 EndOf(const TArray<FYamlTapeEntry>& Tape, const uint32 Position) {
+    const FYamlTapeEntry& Entry = Tape[Position];
+    const bool bContainer = Entry.Kind == FYamlTapeEntry::EKind::Sequence || Entry.Kind == FYamlTapeEntry::EKind::Map;
+    return bContainer ? Entry.Offset : Position + 1;
+}
+
+char FoldCase(const char Char) {
+    return Char >= 'A' && Char <= 'Z' ? Char - 'A' + 'a' : Char;
+}
+
+bool KeyMatches(const FUtf8StringView Scalar, const std::string_view Key, const bool bIgnoreCase) {
+    if (Scalar.Len() != static_cast<int32>(Key.size())) {
+        return false;
+    }
+
+    const char* Data = reinterpret_cast<const char*>(Scalar.GetData());
+    if (!bIgnoreCase) {
+        return std::memcmp(Data, Key.data(), Key.size()) == 0;
+    }
+
+    for (SIZE_T i = 0; i < Key.size(); i++) {
+        if (FoldCase(Data[i]) != FoldCase(Key[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Replays a Part of the Tape as Events, e.g. into a YAML::NodeBuilder
+class FTapeReplay {
+public:
+    FTapeReplay(const TArray<FYamlTapeEntry>& InTape, const TArray<UTF8CHAR>& InStrings,
+                const TArray<std::string>& InTags, YAML::EventHandler& InHandler) :
+        Tape(InTape),
+        Strings(InStrings),
+        Tags(InTags),
+        Handler(InHandler) {}
+
+    void Emit(const uint32 Position) {
+        const FYamlTapeEntry& Entry = Tape[Position];
+        const YAML::Mark Mark = YAML::Mark::null_mark();
+
+        if (Entry.Kind == FYamlTapeEntry::EKind::Alias) {
+            // The anchored Node may lie outside the replayed Part, then it is replayed here
+            if (const YAML::anchor_t* Anchor = Anchors.Find(Entry.Offset)) {
+                Handler.OnAlias(Mark, *Anchor);
+            } else {
+                Emit(Entry.Offset);
+            }
+            return;
+        }
+
+        // The NodeBuilder expects Anchors to be numbered in order of appearance
+        YAML::anchor_t Anchor = YAML::NullAnchor;
+        if (Entry.bAnchored) {
+            Anchor = Anchors.Num() + 1;
+            Anchors.Add(Position, Anchor);
+        }
+
+        const std::string& Tag = Tags[Entry.Tag];
+        const YAML::EmitterStyle Style = static_cast<YAML::EmitterStyle>(Entry.Style);
+        switch (Entry.Kind) {
+        case FYamlTapeEntry::EKind::Null:
+            Handler.OnNull(Mark, Anchor);
+            break;
+        case FYamlTapeEntry::EKind::Scalar:
+            Handler.OnScalar(Mark, Tag, Anchor,
+                             std::string(reinterpret_cast<const char*>(Strings.GetData()) + Entry.Offset, Entry.Size));
+            break;
+        case FYamlTapeEntry::EKind::Sequence:
+            Handler.OnSequenceStart(Mark, Tag, Anchor, Style);
+            EmitChildren(Position);
+            Handler.OnSequenceEnd();
+            break;
+        case FYamlTapeEntry::EKind::Map:
+            Handler.OnMapStart(Mark, Tag, Anchor, Style);
+            EmitChildren(Position);
+            Handler.OnMapEnd();
+            break;
+        default:
+            break;
+        }
+    }
+
+private:
+    void EmitChildren(const uint32 Position) {
+        const uint32 End = Tape[Position].Offset;
+        for (uint32 Child = Position + 1; Child < End; Child = EndOf(Tape, Child)) {
+            Emit(Child);
+        }
+    }
+
+    const TArray<FYamlTapeEntry>& Tape;
+    const TArray<UTF8CHAR>& Strings;
+    const TArray<std::string>& Tags;
+    YAML::EventHandler& Handler;
+
+    // Anchored Positions that have been replayed already
+    TMap<uint32, YAML::anchor_t> Anchors;
+};
+
+bool ParseTape(const char* Data, const SIZE_T Size, FYamlDocument& Out) {
+    LLM_SCOPE_BYTAG(UnrealYAML);
+    try {
+        YAML::Parser Parser(Data, Size);
+        FYamlTapeBuilder Builder(Out);
+        Parser.HandleNextDocument(Builder);
+        Builder.Finish();
+        return true;
+    } catch (const YAML::ParserException&) {
+        Out = FYamlDocument();
+        return false;
+    }
+}
+}
+
+
+// FYamlCursor ---------------------------------------------------------------------------------------------------------
+FYamlCursor::FYamlCursor(const FYamlDocument* InDocument, const uint32 InPosition, const uint32 InParentEnd) :
+    Document(InDocument),
+    Position(InPosition),
+    Index(InPosition),
+    ParentEnd(InParentEnd) {
+    while (Document->Tape[Index].Kind == FYamlTapeEntry::EKind::Alias) {
+        Index = Document->Tape[Index].Offset;
+    }
+}
+
+const FYamlTapeEntry& FYamlCursor::Entry() const {
+    return Document->Tape[Index];
+}
+
+EYamlNodeType FYamlCursor::Type() const {
+    if (!IsValid()) {
+        return EYamlNodeType::Undefined;
+    }
+
+    switch (Entry().Kind) {
+    case FYamlTapeEntry::EKind::Scalar:
+        return EYamlNodeType::Scalar;
+    case FYamlTapeEntry::EKind::Sequence:
+        return EYamlNodeType::Sequence;
+    case FYamlTapeEntry::EKind::Map:
+        return EYamlNodeType::Map;
+    default:
+        return EYamlNodeType::Empty;
+    }
+}
+
+int32 FYamlCursor::Size() const {
+    return IsSequence() || IsMap() ? Entry().Size : 0;
+}
+
+FUtf8StringView FYamlCursor::GetScalar() const {
+    if (!IsScalar()) {
+        return FUtf8StringView();
+    }
+    return FUtf8StringView(Document->Strings.GetData() + Entry().Offset, Entry().Size);
+}
+
+FString FYamlCursor::Scalar() const {
+    const FUtf8StringView Text = GetScalar();
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Text.GetData()), Text.Len());
+    return FString(Converted.Length(), Converted.Get());
+}
+
+FUtf8StringView FYamlCursor::GetTag() const {
+    if (!IsValid()) {
+        return FUtf8StringView();
+    }
+
+    const std::string& Tag = Document->Tags[Entry().Tag];
+    return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Tag.data()), Tag.size());
+}
+
+FYamlCursor FYamlCursor::First() const {
+    if (Size() == 0) {
+        return FYamlCursor();
+    }
+    return FYamlCursor(Document, Index + 1, Entry().Offset);
+}
+
+FYamlCursor FYamlCursor::Next() const {
+    if (!IsValid()) {
+        return FYamlCursor();
+    }
+
+    const uint32 Next = EndOf(Document->Tape, Position);
+    return Next < ParentEnd ? FYamlCursor(Document, Next, ParentEnd) : FYamlCursor();
+}
+
+FYamlCursor FYamlCursor::operator[](const int32 ElementIndex) const {
+    if (!IsSequence() || ElementIndex < 0 || ElementIndex >= Size()) {
+        return FYamlCursor();
+    }
+
+    FYamlCursor Element = First();
+    for (int32 i = 0; i < ElementIndex; i++) {
+        Element = Element.Next();
+    }
+    return Element;
+}
+
+FYamlCursor FYamlCursor::operator[](const FString& Key) const {
+    const FTCHARToUTF8 Utf8(*Key);
+    return FindKey(std::string_view(Utf8.Get(), Utf8.Length()), true);
+}
+
+FYamlCursor FYamlCursor::operator[](const FUtf8StringView Key) const {
+    return FindKey(std::string_view(reinterpret_cast<const char*>(Key.GetData()), Key.Len()), false);
+}
+
+FYamlCursor FYamlCursor::operator[](const FYamlKey& Key) const {
+    return FindKey(Key.GetUtf8(), true);
+}
+
+FYamlCursor FYamlCursor::FindKey(const std::string_view Key, const bool bIgnoreCase) const {
+    if (!IsMap()) {
+        return FYamlCursor();
+    }
+
+    for (FYamlCursor Candidate = First(); Candidate.IsValid(); Candidate = Candidate.Next().Next()) {
+        if (Candidate.IsScalar() && KeyMatches(Candidate.GetScalar(), Key, bIgnoreCase)) {
+            return Candidate.Next();
+        }
+    }
+    return FYamlCursor();
+}
+
+FYamlNode FYamlCursor::ToNode() const {
+    if (!IsValid()) {
+        return FYamlNode();
+    }
+
+    YAML::NodeBuilder Builder;
+    FTapeReplay(Document->Tape, Document->Strings, Document->Tags, Builder).Emit(Index);
+    return FYamlNode(Builder.Root());
+}
+
+
+// FYamlDocument -------------------------------------------------------------------------------------------------------
+bool FYamlDocument::Parse(const FString& String, FYamlDocument& Out) {
+    const FTCHARToUTF8 Utf8(*String);
+    return ParseTape(Utf8.Get(), Utf8.Length(), Out);
+}
+
+bool FYamlDocument::Parse(const FUtf8StringView String, FYamlDocument& Out) {
+    return ParseTape(reinterpret_cast<const char*>(String.GetData()), String.Len(), Out);
+}
+
+bool FYamlDocument::LoadFromFile(const FString& Path, FYamlDocument& Out) {
+    TArray<uint8> Contents;
+    if (!FFileHelper::LoadFileToArray(Contents, *Path)) {
+        return false;
+    }
+    return ParseTape(reinterpret_cast<const char*>(Contents.GetData()), Contents.Num(), Out);
+}
+
+FYamlCursor FYamlDocument::Root() const {
+    return Tape.Num() ? FYamlCursor(this, 0, 1) : FYamlCursor();
+}
+
+SIZE_T FYamlDocument::GetAllocatedSize() const {
+    SIZE_T Size = Tape.GetAllocatedSize() + Strings.GetAllocatedSize() + Tags.GetAllocatedSize();
+    for (const std::string& Tag : Tags) {
+        Size += Tag.capacity();
+    }
+    return Size;
+}
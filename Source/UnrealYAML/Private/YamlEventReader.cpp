@@ -0,0 +1,311 @@
+﻿// Copyright (c) 2021-2026, Forschungszentrum Jülich GmbH. All rights reserved.
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "YamlEventReader.h"
+
+#include "YamlNode.h"
+#include "yaml.h"
+#include "eventhandler.h"
+#include "Async/MappedFileHandle.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+
+#include <cstring>
+#include <istream>
+#include <streambuf>
+
+
+namespace {
+// Thrown through the Parser when the Handler stops reading
+struct FYamlReadAborted {};
+
+// The Origin is the Position of the parsed Text inside the whole Input
+FYamlMark ToMark(const YAML::Mark& Mark, const FYamlMark& Origin = FYamlMark()) {
+    FYamlMark Out;
+    Out.Position = Origin.Position + Mark.pos;
+    Out.Line = Origin.Line + Mark.line;
+    Out.Column = Mark.column;
+    return Out;
+}
+
+FUtf8StringView ToView(const std::string& String) {
+    return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(String.data()), String.size());
+}
+
+// Forwards the Events of yaml-cpp, the Strings are passed on without copying them
+class FEventForwarder final : public YAML::EventHandler {
+public:
+    FEventForwarder(IYamlEventHandler& InHandler, const FYamlMark& InOrigin) :
+        Handler(InHandler),
+        Origin(InOrigin) {}
+
+    virtual void OnDocumentStart(const YAML::Mark& Mark) override {
+        Continue(Handler.OnDocumentStart(ToMark(Mark, Origin)));
+    }
+
+    virtual void OnDocumentEnd() override {
+        Continue(Handler.OnDocumentEnd());
+    }
+
+    virtual void OnNull(const YAML::Mark& Mark, const YAML::anchor_t Anchor) override {
+        Continue(Handler.OnNull(ToMark(Mark, Origin), Anchor));
+    }
+
+    virtual void OnAlias(const YAML::Mark& Mark, const YAML::anchor_t Anchor) override {
+        Continue(Handler.OnAlias(ToMark(Mark, Origin), Anchor));
+    }
+
+    virtual void OnAnchor(const YAML::Mark& Mark, const std::string& Name) override {
+        Continue(Handler.OnAnchor(ToMark(Mark, Origin), ToView(Name)));
+    }
+
+    virtual void OnScalar(const YAML::Mark& Mark, const std::string& Tag, const YAML::anchor_t Anchor,
+                          const std::string& Value) override {
+        Continue(Handler.OnScalar(ToMark(Mark, Origin), ToView(Tag), Anchor, ToView(Value)));
+    }
+
+    virtual void OnSequenceStart(const YAML::Mark& Mark, const std::string& Tag, const YAML::anchor_t Anchor,
+                                 const YAML::EmitterStyle Style) override {
+        const EYamlEmitterStyle NodeStyle = static_cast<EYamlEmitterStyle>(Style);
+        Continue(Handler.OnSequenceStart(ToMark(Mark, Origin), ToView(Tag), Anchor, NodeStyle));
+    }
+
+    virtual void OnSequenceEnd() override {
+        Continue(Handler.OnSequenceEnd());
+    }
+
+    virtual void OnMapStart(const YAML::Mark& Mark, const std::string& Tag, const YAML::anchor_t Anchor,
+                            const YAML::EmitterStyle Style) override {
+        const EYamlEmitterStyle NodeStyle = static_cast<EYamlEmitterStyle>(Style);
+        Continue(Handler.OnMapStart(ToMark(Mark, Origin), ToView(Tag), Anchor, NodeStyle));
+    }
+
+    virtual void OnMapEnd() override {
+        Continue(Handler.OnMapEnd());
+    }
+
+private:
+    static void Continue(const bool bContinue) {
+        if (!bContinue) {
+            throw FYamlReadAborted();
+        }
+    }
+
+    IYamlEventHandler& Handler;
+    FYamlMark Origin;
+};
+
+// Serves an Archive to a std::istream in fixed-size blocks
+class FArchiveStreamBuffer final : public std::streambuf {
+public:
+    explicit FArchiveStreamBuffer(FArchive& InArchive) :
+        Archive(InArchive) {
+        Buffer.SetNumUninitialized(64 * 1024);
+    }
+
+protected:
+    virtual int_type underflow() override {
+        const int64 Count = FMath::Min<int64>(Archive.TotalSize() - Archive.Tell(), Buffer.Num());
+        if (Count <= 0) {
+            return traits_type::eof();
+        }
+
+        Archive.Serialize(Buffer.GetData(), Count);
+        if (Archive.IsError()) {
+            return traits_type::eof();
+        }
+
+        setg(Buffer.GetData(), Buffer.GetData(), Buffer.GetData() + Count);
+        return traits_type::to_int_type(Buffer[0]);
+    }
+
+private:
+    FArchive& Archive;
+    TArray<char> Buffer;
+};
+
+FString DescribeError(const YAML::ParserException& Exception, const FYamlMark& Origin) {
+    const FYamlMark Mark = ToMark(Exception.mark, Origin);
+    return FString::Printf(TEXT("Line %d, Column %d: %s"), Mark.Line + 1, Mark.Column + 1,
+                           UTF8_TO_TCHAR(Exception.msg.c_str()));
+}
+
+EYamlReadResult ReadDocuments(YAML::Parser& Parser, IYamlEventHandler& Handler,
+                              const FYamlMark& Origin = FYamlMark(), FString* OutError = nullptr) {
+    FEventForwarder Forwarder(Handler, Origin);
+
+    try {
+        while (Parser.HandleNextDocument(Forwarder)) {}
+        return EYamlReadResult::Finished;
+    } catch (const FYamlReadAborted&) {
+        return EYamlReadResult::Aborted;
+    } catch (const YAML::ParserException& Exception) {
+        if (OutError) {
+            *OutError = DescribeError(Exception, Origin);
+        }
+        Handler.OnError(ToMark(Exception.mark, Origin), UTF8_TO_TCHAR(Exception.msg.c_str()));
+        return EYamlReadResult::Failed;
+    }
+}
+}
+
+
+EYamlReadResult FYamlEventReader::Read(const FString& String, IYamlEventHandler& Handler) {
+    const FTCHARToUTF8 Utf8(*String);
+    YAML::Parser Parser(Utf8.Get(), Utf8.Length());
+    return ReadDocuments(Parser, Handler);
+}
+
+EYamlReadResult FYamlEventReader::Read(const FUtf8StringView String, IYamlEventHandler& Handler) {
+    YAML::Parser Parser(reinterpret_cast<const char*>(String.GetData()), String.Len());
+    return ReadDocuments(Parser, Handler);
+}
+
+EYamlReadResult FYamlEventReader::ReadFile(const FString& Path, IYamlEventHandler& Handler) {
+    // Read the File in place if possible. The Region must be released before the Handle
+    const TUniquePtr<IMappedFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path));
+    if (Handle && Handle->GetFileSize() > 0) {
+        const TUniquePtr<IMappedFileRegion> Region(Handle->MapRegion());
+        if (Region) {
+            YAML::Parser Parser(reinterpret_cast<const char*>(Region->GetMappedPtr()), Region->GetMappedSize());
+            return ReadDocuments(Parser, Handler);
+        }
+    }
+
+    // Otherwise stream it through a small buffer instead of loading it as a whole
+    const TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileReader(*Path));
+    if (!Archive) {
+        Handler.OnError(FYamlMark(), FString::Printf(TEXT("Could not open %s"), *Path));
+        return EYamlReadResult::Failed;
+    }
+
+    FArchiveStreamBuffer Buffer(*Archive);
+    std::istream Stream(&Buffer);
+    YAML::Parser Parser(Stream);
+    return ReadDocuments(Parser, Handler);
+}
+
+FString FYamlEventReader::ToString(const FUtf8StringView Text) {
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Text.GetData()), Text.Len());
+    return FString(Converted.Length(), Converted.Get());
+}
+
+
+FYamlPushParser::FYamlPushParser(IYamlEventHandler& InHandler) :
+    Handler(&InHandler) {}
+
+FYamlPushParser::FYamlPushParser(TFunction<void(const FYamlNode& Document)> InOnDocument) :
+    OnDocument(MoveTemp(InOnDocument)) {}
+
+bool FYamlPushParser::Feed(const TArrayView<const uint8> Chunk) {
+    if (Result != EYamlReadResult::Finished) {
+        return false;
+    }
+
+    Buffer.Append(Chunk.GetData(), Chunk.Num());
+    return ScanLines(false);
+}
+
+EYamlReadResult FYamlPushParser::Finish() {
+    if (Result == EYamlReadResult::Finished && ScanLines(true)) {
+        Flush(Buffer.Num());
+    }
+    return Result;
+}
+
+bool FYamlPushParser::ScanLines(const bool bFinal) {
+    while (!bAfterDirective && ScanOffset < Buffer.Num()) {
+        const uint8* Line = Buffer.GetData() + ScanOffset;
+        const int32 Remaining = Buffer.Num() - ScanOffset;
+
+        // Wait for the rest of an incomplete Line
+        const uint8* Break = static_cast<const uint8*>(std::memchr(Line, '\n', Remaining));
+        if (!Break && !bFinal) {
+            break;
+        }
+
+        int32 Length = Break ? Break - Line : Remaining;
+        const int32 Next = Break ? Length + 1 : Length;
+
+        // Skip the Byte Order Mark in front of the Input
+        if (Origin.Position == 0 && ScanOffset == 0 && Length >= 3 && Line[0] == 0xEF && Line[1] == 0xBB &&
+            Line[2] == 0xBF) {
+            Line += 3;
+            Length -= 3;
+        }
+
+        const YAML::LineKind Kind = YAML::ClassifyLine(reinterpret_cast<const char*>(Line), Length);
+        if (Kind == YAML::LineKind::Directive) {
+            // Directives carry over to all later Documents, so these can no longer be parsed on their own
+            bAfterDirective = true;
+            break;
+        }
+
+        switch (Kind) {
+            case YAML::LineKind::DocumentStart:
+                // Either ends the open Document or starts the first one after the Directives
+                if (bDocumentOpen && !Flush(ScanOffset)) {
+                    return false;
+                }
+                bDocumentOpen = true;
+                break;
+            case YAML::LineKind::DocumentEnd:
+                // Further "..." after a closed Document end nothing, but alone they would be parsed as an empty
+                // Document. Only at the start of the Input they are one.
+                if (bDocumentOpen || Origin.Position == 0) {
+                    if (!Flush(ScanOffset + Next)) {
+                        return false;
+                    }
+                } else {
+                    Discard(ScanOffset + Next);
+                }
+                bDocumentOpen = false;
+                break;
+            case YAML::LineKind::Content:
+                bDocumentOpen = true;
+                break;
+            default:
+                break;
+        }
+
+        // Flushing moved the Line to the front of the Buffer
+        ScanOffset += Next;
+    }
+    return true;
+}
+
+bool FYamlPushParser::Flush(const int32 End) {
+    const char* Data = reinterpret_cast<const char*>(Buffer.GetData());
+
+    if (Handler) {
+        YAML::Parser Parser(Data, End);
+        Result = ReadDocuments(Parser, *Handler, Origin, &Error);
+    } else {
+        // The Marks of the Nodes and Errors are placed inside the whole Input
+        YAML::Mark Start;
+        Start.pos = Origin.Position;
+        Start.line = Origin.Line;
+        try {
+            for (const YAML::Node& Document : YAML::LoadAll(Data, End, Start)) {
+                OnDocument(FYamlNode(Document));
+            }
+        } catch (const YAML::ParserException& Exception) {
+            Error = DescribeError(Exception, FYamlMark());
+            Result = EYamlReadResult::Failed;
+        }
+    }
+
+    Discard(End);
+    return Result == EYamlReadResult::Finished;
+}
+
+void FYamlPushParser::Discard(const int32 End) {
+    for (int32 i = 0; i < End; i++) {
+        Origin.Line += Buffer[i] == '\n';
+    }
+    Origin.Position += End;
+
+    Buffer.RemoveAt(0, End, false);
+    ScanOffset -= End;
+}
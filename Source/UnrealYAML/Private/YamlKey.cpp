@@ -0,0 +1,20 @@
+﻿// Copyright (c) 2021-2026, Forschungszentrum Jülich GmbH. All rights reserved.
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "YamlKey.h"
+
+
+FYamlKey::FYamlKey(const TCHAR* Key) :
+    FYamlKey(FString(Key)) {}
+
+FYamlKey::FYamlKey(const FString& Key) :
+    Utf8(TCHAR_TO_UTF8(*Key)),
+    Hash(YAML::detail::node_data::hash_key(Utf8)) {}
+
+FYamlKey::FYamlKey(const FUtf8StringView Key) :
+    Utf8(reinterpret_cast<const char*>(Key.GetData()), Key.Len()),
+    Hash(YAML::detail::node_data::hash_key(Utf8)) {}
+
+FString FYamlKey::ToString() const {
+    return FString(UTF8_TO_TCHAR(Utf8.c_str()));
+}
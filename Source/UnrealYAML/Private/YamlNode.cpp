@@ -2,6 +2,49 @@
 // Licensed under the MIT License. See LICENSE file for details.
 
 #include "YamlNode.h"
+#include "YamlStats.h"
+
+namespace {
+char FoldCase(const char Char) {
+    return Char >= 'A' && Char <= 'Z' ? Char - 'A' + 'a' : Char;
+}
+
+bool TextEquals(const std::string_view Scalar, const std::string_view Text, const ESearchCase::Type SearchCase) {
+    if (Scalar.size() != Text.size()) {
+        return false;
+    }
+    if (SearchCase == ESearchCase::CaseSensitive) {
+        return Scalar == Text;
+    }
+
+    for (SIZE_T i = 0; i < Text.size(); i++) {
+        if (FoldCase(Scalar[i]) != FoldCase(Text[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string_view ToStdView(const FUtf8StringView Text) {
+    return std::string_view(reinterpret_cast<const char*>(Text.GetData()), Text.Len());
+}
+
+// Short Texts are converted on the Stack
+bool TextEquals(const std::string_view Scalar, const FStringView Text, const ESearchCase::Type SearchCase) {
+    const FTCHARToUTF8 Converted(Text.GetData(), Text.Len());
+    return TextEquals(Scalar, std::string_view(Converted.Get(), Converted.Length()), SearchCase);
+}
+
+// The Text of a Scalar, nullptr for all other Nodes
+const std::string* ScalarOf(const YAML::detail::node* Ptr) {
+    return Ptr && Ptr->type() == YAML::NodeType::Scalar ? &Ptr->scalar() : nullptr;
+}
+
+FString ToFString(const std::string_view Scalar) {
+    const FUTF8ToTCHAR Converted(Scalar.data(), static_cast<int32>(Scalar.size()));
+    return FString(Converted.Length(), Converted.Get());
+}
+}
 
 EYamlNodeType FYamlNode::Type() const {
     try {
@@ -33,6 +76,20 @@ void FYamlNode::SetTag(const FString& Tag) {
     Node.SetTag(TCHAR_TO_UTF8(*Tag));
 }
 
+FYamlMark FYamlNode::Mark() const {
+    try {
+        const YAML::Mark Position = Node.Mark();
+        FYamlMark Out;
+        Out.Position = Position.pos;
+        Out.Line = Position.line;
+        Out.Column = Position.column;
+        return Out;
+    } catch (YAML::InvalidNode) {
+        UE_LOG(LogTemp, Warning, TEXT("Node was Invalid, returning default value for Mark()!"))
+        return FYamlMark();
+    }
+}
+
 
 bool FYamlNode::Is(const FYamlNode& Other) const {
     try {
@@ -53,15 +110,60 @@ bool FYamlNode::Reset(const FYamlNode& Other) {
     }
 }
 
+FYamlNode FYamlNode::Clone(const bool bPreserveAliases) const {
+    LLM_SCOPE_BYTAG(UnrealYAML);
+    return FYamlNode(bPreserveAliases ? YAML::Clone(Node) : YAML::CloneUnshared(Node));
+}
+
+FYamlNode FYamlNode::Freeze() const {
+    LLM_SCOPE_BYTAG(UnrealYAML);
+    try {
+        return FYamlNode(YAML::Freeze(Node));
+    } catch (YAML::InvalidNode) {
+        UE_LOG(LogTemp, Warning, TEXT("Node was Invalid and can't be Frozen!"))
+        return FYamlNode();
+    }
+}
+
+FYamlMemoryStats FYamlNode::GetMemoryStats() const {
+    try {
+        const YAML::MemoryStats Stats = YAML::GetMemoryStats(Node);
+        FYamlMemoryStats Out;
+        Out.Nodes = Stats.nodes;
+        Out.ScalarBytes = Stats.scalarBytes;
+        Out.ContainerBytes = Stats.containerBytes;
+        Out.AllocatedBytes = Stats.allocatedBytes;
+        return Out;
+    } catch (YAML::InvalidNode) {
+        UE_LOG(LogTemp, Warning, TEXT("Node was Invalid, returning empty Memory Stats"))
+        return FYamlMemoryStats();
+    }
+}
+
 FString FYamlNode::Scalar() const {
     try {
-        return FString(Node.Scalar().c_str());
+        return ToFString(Node.Scalar());
     } catch (YAML::InvalidNode) {
         UE_LOG(LogTemp, Warning, TEXT("Node was Invalid, returning default value for Scalar()"))
         return "";
     }
 }
 
+std::string_view FYamlNode::ScalarUtf8() const {
+    const std::string* Scalar = ScalarOf(YAML::detail::node_access::get(Node));
+    return Scalar ? std::string_view(*Scalar) : std::string_view();
+}
+
+bool FYamlNode::ScalarEquals(const FStringView Text, const ESearchCase::Type SearchCase) const {
+    const std::string* Scalar = ScalarOf(YAML::detail::node_access::get(Node));
+    return Scalar && TextEquals(*Scalar, Text, SearchCase);
+}
+
+bool FYamlNode::ScalarEquals(const FUtf8StringView Text, const ESearchCase::Type SearchCase) const {
+    const std::string* Scalar = ScalarOf(YAML::detail::node_access::get(Node));
+    return Scalar && TextEquals(*Scalar, ToStdView(Text), SearchCase);
+}
+
 FString FYamlNode::GetContent() const {
     std::stringstream Stream;
     Stream << Node;
@@ -76,3 +178,17 @@ int32 FYamlNode::Size() const {
         return 0;
     }
 }
+
+FString FYamlNodeRef::Scalar() const {
+    return ToFString(ScalarUtf8());
+}
+
+bool FYamlNodeRef::ScalarEquals(const FStringView Text, const ESearchCase::Type SearchCase) const {
+    const std::string* Scalar = ScalarOf(Ptr);
+    return Scalar && TextEquals(*Scalar, Text, SearchCase);
+}
+
+bool FYamlNodeRef::ScalarEquals(const FUtf8StringView Text, const ESearchCase::Type SearchCase) const {
+    const std::string* Scalar = ScalarOf(Ptr);
+    return Scalar && TextEquals(*Scalar, ToStdView(Text), SearchCase);
+}
@@ -0,0 +1,46 @@
+﻿// Copyright (c) 2021-2026, Forschungszentrum Jülich GmbH. All rights reserved.
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "YamlParseAsyncAction.h"
+
+#include "YamlParsing.h"
+#include "Async/Async.h"
+
+
+UYamlParseAsyncAction* UYamlParseAsyncAction::ParseYamlAsync(UObject* WorldContextObject, const FString& String) {
+    UYamlParseAsyncAction* Action = NewObject<UYamlParseAsyncAction>();
+    Action->Input = String;
+    Action->RegisterWithGameInstance(WorldContextObject);
+    return Action;
+}
+
+UYamlParseAsyncAction* UYamlParseAsyncAction::LoadYamlFromFileAsync(UObject* WorldContextObject, const FString& Path) {
+    UYamlParseAsyncAction* Action = NewObject<UYamlParseAsyncAction>();
+    Action->Input = Path;
+    Action->bIsFile = true;
+    Action->RegisterWithGameInstance(WorldContextObject);
+    return Action;
+}
+
+void UYamlParseAsyncAction::Activate() {
+    TFuture<FYamlParseResult> Future = bIsFile
+        ? UYamlParsing::LoadYamlFromFileAsync(Input)
+        : UYamlParsing::ParseYamlAsync(Input);
+
+    // Only the finished Node is handed to the Game Thread. The Action might be gone by then
+    Future.Next([WeakThis = TWeakObjectPtr<UYamlParseAsyncAction>(this)](FYamlParseResult Result) {
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Result = MoveTemp(Result)]() {
+            UYamlParseAsyncAction* This = WeakThis.Get();
+            if (!This) {
+                return;
+            }
+
+            if (Result.HasValue()) {
+                This->OnSuccess.Broadcast(Result.GetValue(), FString());
+            } else {
+                This->OnFailure.Broadcast(FYamlNode(), Result.GetError());
+            }
+            This->SetReadyToDestroy();
+        });
+    });
+}
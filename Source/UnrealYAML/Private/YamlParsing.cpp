@@ -3,28 +3,148 @@
 
 #include "YamlParsing.h"
 
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "Async/ParallelFor.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "YamlStats.h"
+
 
 DEFINE_LOG_CATEGORY(LogYamlParsing)
 
 
 // Parsing into/from Files ---------------------------------------------------------------------------------------------
-bool UYamlParsing::ParseYaml(const FString String, FYamlNode& Out) {
+static bool ParseUtf8(const char* Data, const int64 Size, FYamlNode& Out, FString* OutError = nullptr) {
+    LLM_SCOPE_BYTAG(UnrealYAML);
     try {
-        Out = FYamlNode(YAML::Load(TCHAR_TO_UTF8(*String)));
+        Out = FYamlNode(YAML::Load(Data, Size));
+        return true;
+    } catch (const YAML::ParserException& Exception) {
+        if (OutError) {
+            *OutError = UTF8_TO_TCHAR(Exception.what());
+        }
+        return false;
+    }
+}
+
+static bool LoadFile(const FString& Path, FYamlNode& Out, FYamlFileLoadStats& Stats, FString* OutError = nullptr) {
+    Stats = FYamlFileLoadStats();
+
+    // Try to parse the File in place. The Region must be released before the Handle
+    const TUniquePtr<IMappedFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path));
+    if (Handle && Handle->GetFileSize() > 0) {
+        const TUniquePtr<IMappedFileRegion> Region(Handle->MapRegion());
+        if (Region) {
+            Stats.BytesMapped = Region->GetMappedSize();
+            UE_LOG(LogYamlParsing, Verbose, TEXT("Parsing %lld mapped bytes from %s"), Stats.BytesMapped, *Path)
+
+            const char* Data = reinterpret_cast<const char*>(Region->GetMappedPtr());
+            return ParseUtf8(Data, Region->GetMappedSize(), Out, OutError);
+        }
+    }
+
+    // Mapping is not available (e.g. inside a Pak File), read the raw bytes instead
+    TArray<uint8> Contents;
+    if (!FFileHelper::LoadFileToArray(Contents, *Path)) {
+        if (OutError) {
+            *OutError = FString::Printf(TEXT("Could not read %s"), *Path);
+        }
+        return false;
+    }
+
+    Stats.BytesCopied = Contents.Num();
+    UE_LOG(LogYamlParsing, Verbose, TEXT("Parsing %lld copied bytes from %s"), Stats.BytesCopied, *Path)
+
+    return ParseUtf8(reinterpret_cast<const char*>(Contents.GetData()), Contents.Num(), Out, OutError);
+}
+
+bool UYamlParsing::ParseYaml(const FString& String, FYamlNode& Out) {
+    // Parses directly from the converted buffer, without an intermediate std::stringstream
+    const FTCHARToUTF8 Utf8(*String);
+    return ParseUtf8(Utf8.Get(), Utf8.Length(), Out);
+}
+
+bool UYamlParsing::ParseYaml(const FUtf8StringView String, FYamlNode& Out) {
+    return ParseUtf8(reinterpret_cast<const char*>(String.GetData()), String.Len(), Out);
+}
+
+bool UYamlParsing::ParseYaml(const TArrayView<const uint8> Bytes, FYamlNode& Out) {
+    return ParseUtf8(reinterpret_cast<const char*>(Bytes.GetData()), Bytes.Num(), Out);
+}
+
+bool UYamlParsing::ParseYaml(const std::string_view String, FYamlNode& Out) {
+    return ParseUtf8(String.data(), String.size(), Out);
+}
+
+static bool ParseAllUtf8(const char* Data, const int64 Size, TArray<FYamlNode>& Out) {
+    const auto RunParallel = [](const std::size_t Count, const std::function<void(std::size_t)>& Body) {
+        ParallelFor(static_cast<int32>(Count), [&Body](const int32 Index) {
+            LLM_SCOPE_BYTAG(UnrealYAML);
+            Body(Index);
+        });
+    };
+
+    try {
+        const std::vector<YAML::Node> Documents = YAML::LoadAll(Data, Size, RunParallel);
+
+        Out.Reset(static_cast<int32>(Documents.size()));
+        for (const YAML::Node& Document : Documents) {
+            Out.Emplace(Document);
+        }
         return true;
     } catch (YAML::ParserException) {
         return false;
     }
 }
 
+bool UYamlParsing::ParseAllYaml(const FString& String, TArray<FYamlNode>& Out) {
+    const FTCHARToUTF8 Utf8(*String);
+    return ParseAllUtf8(Utf8.Get(), Utf8.Length(), Out);
+}
+
+bool UYamlParsing::ParseAllYaml(const TArrayView<const uint8> Bytes, TArray<FYamlNode>& Out) {
+    return ParseAllUtf8(reinterpret_cast<const char*>(Bytes.GetData()), Bytes.Num(), Out);
+}
+
 bool UYamlParsing::LoadYamlFromFile(const FString Path, FYamlNode& Out) {
-    FString Contents;
-    if (FFileHelper::LoadFileToString(Contents, *Path)) {
-        return ParseYaml(Contents, Out);
-    }
-    return false;
+    FYamlFileLoadStats Stats;
+    return LoadYamlFromFile(Path, Out, Stats);
+}
+
+bool UYamlParsing::LoadYamlFromFile(const FString Path, FYamlNode& Out, FYamlFileLoadStats& Stats) {
+    return LoadFile(Path, Out, Stats);
+}
+
+
+// Parsing on Worker Threads -------------------------------------------------------------------------------------------
+TFuture<FYamlParseResult> UYamlParsing::ParseYamlAsync(FString String) {
+    return Async(EAsyncExecution::ThreadPool, [String = MoveTemp(String)]() -> FYamlParseResult {
+        const FTCHARToUTF8 Utf8(*String);
+
+        FYamlNode Node;
+        FString Error;
+        if (!ParseUtf8(Utf8.Get(), Utf8.Length(), Node, &Error)) {
+            return MakeError(MoveTemp(Error));
+        }
+        return MakeValue(MoveTemp(Node));
+    });
 }
 
+TFuture<FYamlParseResult> UYamlParsing::LoadYamlFromFileAsync(FString Path) {
+    return Async(EAsyncExecution::ThreadPool, [Path = MoveTemp(Path)]() -> FYamlParseResult {
+        FYamlNode Node;
+        FYamlFileLoadStats Stats;
+        FString Error;
+        if (!LoadFile(Path, Node, Stats, &Error)) {
+            return MakeError(MoveTemp(Error));
+        }
+        return MakeValue(MoveTemp(Node));
+    });
+}
+
+
 void UYamlParsing::WriteYamlToFile(const FString Path, const FYamlNode Node) {
     FFileHelper::SaveStringToFile(Node.GetContent(), *Path);
 }
@@ -0,0 +1,350 @@
+﻿// Copyright (c) 2021-2026, Forschungszentrum Jülich GmbH. All rights reserved.
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "YamlPath.h"
+#include "Misc/ScopeLock.h"
+
+namespace {
+using FNode = YAML::detail::node;
+using FMemory = YAML::detail::shared_memory_holder;
+
+// The Value of a Key, if the Node is a Map that has it
+const FNode* FindKey(const FNode& Node, const FYamlKey& Key, const FMemory& Memory) {
+    if (Node.type() != YAML::NodeType::Map) {
+        return nullptr;
+    }
+    const FNode* Value = Node.get(Key, Memory);
+    return Value && Value->is_defined() ? Value : nullptr;
+}
+
+// An Element of a Sequence, or the Value of an Integer Key of a Map
+const FNode* FindIndex(const FNode& Node, int32 Index, const FMemory& Memory) {
+    const FNode* Value = nullptr;
+    if (Node.type() == YAML::NodeType::Sequence) {
+        const int32 Size = static_cast<int32>(Node.size());
+        if (Index < 0) {
+            Index += Size;
+        }
+        if (Index >= 0 && Index < Size) {
+            Value = Node.get(Index, Memory);
+        }
+    } else if (Node.type() == YAML::NodeType::Map) {
+        Value = Node.get(Index, Memory);
+    }
+    return Value && Value->is_defined() ? Value : nullptr;
+}
+
+bool IsNameChar(const TCHAR Char) {
+    return Char != TEXT('.') && Char != TEXT('[') && Char != TEXT(']');
+}
+
+std::string ToUtf8(const FString& Text) {
+    return TCHAR_TO_UTF8(*Text);
+}
+}
+
+
+struct FYamlPath::FCache {
+    FCriticalSection Lock;
+
+    /** The Node the Matches were found in, which keeps them alive */
+    YAML::Node Root;
+    const FNode* RootPtr = nullptr;
+
+    /** The Revision of the Document when the Matches were found, see YAML::detail::memory_holder::revision() */
+    std::size_t Revision = 0;
+    TArray<const FNode*> Matches;
+};
+
+FYamlPath::FYamlPath(const FString& InPath, const bool bCacheMatches) :
+    Path(InPath) {
+    if (!Compile()) {
+        Steps.Empty();
+    }
+    if (bCacheMatches) {
+        Cache = MakeUnique<FCache>();
+    }
+}
+
+FYamlPath::FYamlPath(const FYamlPath& Other) :
+    Path(Other.Path),
+    Error(Other.Error),
+    Steps(Other.Steps) {
+    if (Other.Cache) {
+        Cache = MakeUnique<FCache>();
+    }
+}
+
+FYamlPath::FYamlPath(FYamlPath&& Other) = default;
+
+FYamlPath& FYamlPath::operator=(const FYamlPath& Other) {
+    if (this != &Other) {
+        Path = Other.Path;
+        Error = Other.Error;
+        Steps = Other.Steps;
+        Cache.Reset(Other.Cache ? new FCache() : nullptr);
+    }
+    return *this;
+}
+
+FYamlPath& FYamlPath::operator=(FYamlPath&& Other) = default;
+
+FYamlPath::~FYamlPath() = default;
+
+bool FYamlPath::Compile() {
+    const int32 Len = Path.Len();
+    int32 Pos = 0;
+
+    auto Fail = [this, &Pos](const TCHAR* Expected) {
+        Error = FString::Printf(TEXT("Expected %s at Position %d of Path \"%s\""), Expected, Pos, *Path);
+        return false;
+    };
+
+    // Reads a Key up to the next Dot or Bracket, or up to one of the given Characters
+    auto ReadName = [this, &Pos, Len](const TCHAR* Terminators) {
+        const int32 Start = Pos;
+        while (Pos < Len && IsNameChar(Path[Pos]) && !FCString::Strchr(Terminators, Path[Pos])) {
+            Pos++;
+        }
+        return Path.Mid(Start, Pos - Start).TrimStartAndEnd();
+    };
+
+    // Reads a quoted Text, if there is one
+    auto ReadQuoted = [this, &Pos, Len](FString& Out) {
+        const TCHAR Quote = Path[Pos];
+        int32 End = Pos + 1;
+        while (End < Len && Path[End] != Quote) {
+            End++;
+        }
+        if (End >= Len) {
+            return false;
+        }
+        Out = Path.Mid(Pos + 1, End - Pos - 1);
+        Pos = End + 1;
+        return true;
+    };
+
+    auto SkipSpaces = [this, &Pos, Len]() {
+        while (Pos < Len && FChar::IsWhitespace(Path[Pos])) {
+            Pos++;
+        }
+    };
+
+    while (Pos < Len) {
+        const TCHAR Char = Path[Pos];
+
+        if (Char != TEXT('[')) {
+            // the first Key needs no Dot
+            if (Char == TEXT('.')) {
+                Pos++;
+            } else if (Pos > 0) {
+                return Fail(TEXT("'.' or '['"));
+            }
+
+            const FString Name = ReadName(TEXT(""));
+            if (Name.IsEmpty()) {
+                return Fail(TEXT("a Key"));
+            }
+
+            FStep& Step = Steps.AddDefaulted_GetRef();
+            if (Name == TEXT("*")) {
+                Step.Type = EStepType::Wildcard;
+            } else {
+                Step.Type = EStepType::Key;
+                Step.Key.Emplace(Name);
+            }
+            continue;
+        }
+
+        Pos++;
+        SkipSpaces();
+        if (Pos >= Len) {
+            return Fail(TEXT("a Selector"));
+        }
+
+        FStep& Step = Steps.AddDefaulted_GetRef();
+        const TCHAR Selector = Path[Pos];
+        if (Selector == TEXT('*')) {
+            Step.Type = EStepType::Wildcard;
+            Pos++;
+        } else if (Selector == TEXT('"') || Selector == TEXT('\'')) {
+            FString Name;
+            if (!ReadQuoted(Name)) {
+                return Fail(TEXT("a closing Quote"));
+            }
+            Step.Type = EStepType::Key;
+            Step.Key.Emplace(Name);
+        } else if (Selector == TEXT('-') || FChar::IsDigit(Selector)) {
+            const int32 Start = Pos++;
+            while (Pos < Len && FChar::IsDigit(Path[Pos])) {
+                Pos++;
+            }
+            const FString Digits = Path.Mid(Start, Pos - Start);
+            if (Digits == TEXT("-")) {
+                return Fail(TEXT("a Digit"));
+            }
+            Step.Type = EStepType::Index;
+            Step.Index = FCString::Atoi(*Digits);
+        } else if (Selector == TEXT('?')) {
+            Pos++;
+            const FString Name = ReadName(TEXT("=!"));
+            if (Name.IsEmpty()) {
+                return Fail(TEXT("a Key to filter by"));
+            }
+            Step.Type = EStepType::Filter;
+            Step.Key.Emplace(Name);
+
+            if (Pos < Len && Path[Pos] != TEXT(']')) {
+                if (Path[Pos] == TEXT('!')) {
+                    Step.Filter = EFilterType::NotEquals;
+                    Pos++;
+                } else {
+                    Step.Filter = EFilterType::Equals;
+                }
+                if (Pos >= Len || Path[Pos] != TEXT('=')) {
+                    return Fail(TEXT("'='"));
+                }
+                Pos++;
+                // "==" reads like "="
+                if (Pos < Len && Path[Pos] == TEXT('=')) {
+                    Pos++;
+                }
+
+                SkipSpaces();
+                FString Text;
+                if (Pos < Len && (Path[Pos] == TEXT('"') || Path[Pos] == TEXT('\''))) {
+                    if (!ReadQuoted(Text)) {
+                        return Fail(TEXT("a closing Quote"));
+                    }
+                } else {
+                    Text = ReadName(TEXT(""));
+                }
+                Step.Text = ToUtf8(Text);
+            }
+        } else {
+            return Fail(TEXT("an Index, '*', '?' or a quoted Key"));
+        }
+
+        SkipSpaces();
+        if (Pos >= Len || Path[Pos] != TEXT(']')) {
+            return Fail(TEXT("']'"));
+        }
+        Pos++;
+    }
+    return true;
+}
+
+bool FYamlPath::Visit(const FNode* Node, int32 Step, const FMemory& Memory,
+                      const TFunctionRef<bool(const FNode&)> Callback) const {
+    // Keys and Indexes lead to at most one Node, so they are followed without recursion
+    for (; Step < Steps.Num(); Step++) {
+        const FStep& Current = Steps[Step];
+        switch (Current.Type) {
+        case EStepType::Key:
+            Node = FindKey(*Node, Current.Key.GetValue(), Memory);
+            break;
+        case EStepType::Index:
+            Node = FindIndex(*Node, Current.Index, Memory);
+            break;
+        case EStepType::Wildcard:
+        case EStepType::Filter:
+            for (auto It = Node->begin(), End = Node->end(); It != End; ++It) {
+                const auto Entry = *It;
+                const FNode* Value = Entry.pNode ? Entry.pNode : Entry.second;
+                if (Current.Type == EStepType::Filter) {
+                    const FNode* Field = FindKey(*Value, Current.Key.GetValue(), Memory);
+                    const bool bEquals = Field && Field->type() == YAML::NodeType::Scalar &&
+                        Field->scalar() == Current.Text;
+                    if (!Field || (Current.Filter == EFilterType::Equals && !bEquals) ||
+                        (Current.Filter == EFilterType::NotEquals && bEquals)) {
+                        continue;
+                    }
+                }
+                if (!Visit(Value, Step + 1, Memory, Callback)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        if (!Node) {
+            return true;
+        }
+    }
+    return Callback(*Node);
+}
+
+void FYamlPath::Evaluate(const FYamlNode& Root, const TFunctionRef<bool(const FNode&)> Callback) const {
+    const FNode* RootPtr = YAML::detail::node_access::get(Root.Node);
+    if (!RootPtr || !RootPtr->is_defined() || !IsValid()) {
+        return;
+    }
+
+    const FMemory& Memory = YAML::detail::node_access::memory(Root.Node);
+    if (!Cache) {
+        Visit(RootPtr, 0, Memory, Callback);
+        return;
+    }
+
+    FScopeLock Lock(&Cache->Lock);
+    // frozen Documents can not be modified
+    const std::size_t Revision = Memory->revision();
+    if (Cache->RootPtr != RootPtr || (!RootPtr->is_frozen() && Cache->Revision != Revision)) {
+        Cache->Matches.Reset();
+        Visit(RootPtr, 0, Memory, [this](const FNode& Match) {
+            Cache->Matches.Add(&Match);
+            return true;
+        });
+        Cache->Root.reset(Root.Node);
+        Cache->RootPtr = RootPtr;
+        Cache->Revision = Revision;
+    }
+
+    for (const FNode* Match : Cache->Matches) {
+        if (!Callback(*Match)) {
+            break;
+        }
+    }
+}
+
+FYamlNodeRef FYamlPath::Resolve(const FYamlNode& Root) const {
+    const FNode* Found = nullptr;
+    Evaluate(Root, [&Found](const FNode& Match) {
+        Found = &Match;
+        return false;
+    });
+    return Found ? FYamlNodeRef(Root.Node, Found) : FYamlNodeRef();
+}
+
+TOptional<FYamlNode> FYamlPath::Find(const FYamlNode& Root) const {
+    const FYamlNodeRef Found = Resolve(Root);
+    if (Found) {
+        return Found.ToNode();
+    }
+    return {};
+}
+
+TArray<FYamlNode> FYamlPath::FindAll(const FYamlNode& Root) const {
+    TArray<FYamlNode> Found;
+    Evaluate(Root, [&Root, &Found](const FNode& Match) {
+        Found.Add(FYamlNodeRef(Root.Node, &Match).ToNode());
+        return true;
+    });
+    return Found;
+}
+
+void FYamlPath::ForEachMatch(const FYamlNode& Root, const TFunctionRef<void(FYamlNodeRef)> Callback) const {
+    Evaluate(Root, [&Root, &Callback](const FNode& Match) {
+        Callback(FYamlNodeRef(Root.Node, &Match));
+        return true;
+    });
+}
+
+void FYamlPath::ResetCache() const {
+    if (Cache) {
+        FScopeLock Lock(&Cache->Lock);
+        Cache->Root.reset();
+        Cache->RootPtr = nullptr;
+        Cache->Matches.Empty();
+    }
+}
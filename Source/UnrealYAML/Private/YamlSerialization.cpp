@@ -410,16 +410,16 @@ void UYamlSerialization::DeserializeProperty(const FYamlNode& Node, const FPrope
         }
 
         // Try conversion to biggest int/float type => any smaller type should also work
-        const bool CanConvert = NumericProperty->IsInteger() ? Node.CanConvertTo<int64>() : Node.CanConvertTo<double>();
-        if (Options.StrictTypes && Node.IsDefined() && !CanConvert) {
+        if (Options.StrictTypes && Node.IsDefined() &&
+            !(NumericProperty->IsInteger() ? Node.CanConvertTo<int64>() : Node.CanConvertTo<double>())) {
             Result.AddError(TEXT("Cannot convert '%s' to %s"), *Node.Scalar(),
                             NumericProperty->IsInteger() ? TEXT("an Integer") : TEXT("a Float"));
             return;
         }
 
-        const auto ValueAsString = Node.AsOptional<FString>();
-        if (ValueAsString.IsSet()) {
-            NumericProperty->SetNumericPropertyValueFromString(PropertyValue, **ValueAsString);
+        FString ValueAsString;
+        if (Node.TryAs(ValueAsString)) {
+            NumericProperty->SetNumericPropertyValueFromString(PropertyValue, *ValueAsString);
         }
     } else if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(&Property)) {
         DeserializeScalarValue<bool>(Node, BoolProperty, PropertyValue, TEXT("Bool"), Options.StrictTypes, Result);
@@ -431,43 +431,37 @@ void UYamlSerialization::DeserializeProperty(const FYamlNode& Node, const FPrope
     } else if (const FTextProperty* TextProperty = CastField<FTextProperty>(&Property)) {
         DeserializeScalarValue<FText>(Node, TextProperty, PropertyValue, TEXT("String"), Options.StrictTypes, Result);
     } else if (const FSoftObjectProperty* SoftObjProperty = CastField<FSoftObjectProperty>(&Property)) {
-        if (!EnsureScalarOfType<FString>(Node, TEXT("String"), Options.StrictTypes, Result)) {
+        FString Value;
+        if (!ConvertScalar(Node, Value, TEXT("String"), Options.StrictTypes, Result)) {
             return;
         }
 
-        const auto Value = Node.AsOptional<FString>();
-        if (Value.IsSet()) {
-            const auto Object = StaticLoadObject(UObject::StaticClass(), nullptr, **Value);
-
-            if (!IsValid(Object)) {
-                Result.AddError(TEXT("Cannot find Object '%s'"), *Value.GetValue());
-                return;
-            }
-
-            SoftObjProperty->SetObjectPropertyValue(PropertyValue, Object);
+        const auto Object = StaticLoadObject(UObject::StaticClass(), nullptr, *Value);
+        if (!IsValid(Object)) {
+            Result.AddError(TEXT("Cannot find Object '%s'"), *Value);
+            return;
         }
+
+        SoftObjProperty->SetObjectPropertyValue(PropertyValue, Object);
     } else if (const FClassProperty* ClassProperty = CastField<FClassProperty>(&Property)) {
-        if (!EnsureScalarOfType<FString>(Node, TEXT("String"), Options.StrictTypes, Result)) {
+        FString Value;
+        if (!ConvertScalar(Node, Value, TEXT("String"), Options.StrictTypes, Result)) {
             return;
         }
 
-        const auto Value = Node.AsOptional<FString>();
-        if (Value.IsSet()) {
-            auto Class = StaticLoadClass(UObject::StaticClass(), nullptr, **Value);
-
-            if (!Class) {
-                if (const auto Bp = Cast<UBlueprint>(StaticLoadObject(UBlueprint::StaticClass(), nullptr, **Value))) {
-                    Class = Bp->GeneratedClass;
-                }
-            }
-
-            if (!Class) {
-                Result.AddError(TEXT("Cannot find Class '%s'"), **Value);
-                return;
+        auto Class = StaticLoadClass(UObject::StaticClass(), nullptr, *Value);
+        if (!Class) {
+            if (const auto Bp = Cast<UBlueprint>(StaticLoadObject(UBlueprint::StaticClass(), nullptr, *Value))) {
+                Class = Bp->GeneratedClass;
             }
+        }
 
-            ClassProperty->SetObjectPropertyValue(PropertyValue, Class);
+        if (!Class) {
+            Result.AddError(TEXT("Cannot find Class '%s'"), *Value);
+            return;
         }
+
+        ClassProperty->SetObjectPropertyValue(PropertyValue, Class);
     } else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(&Property)) {
         if (!EnsureNodeType(Node, EYamlNodeType::Sequence, Options.StrictTypes, Result)) {
             return;
@@ -616,8 +610,8 @@ int64 UYamlSerialization::DeserializeEnumValue(const FYamlNode& Node, const UEnu
     }
 
     // Try to parse the Value is an Int
-    if (Node.CanConvertTo<int>()) {
-        const int64 IntValue = Node.As<int64>();
+    if (int32 Int; Node.TryAs(Int)) {
+        const int64 IntValue = Int;
 
         if (CheckEnums && !Enum->IsValidEnumValueOrBitfield(IntValue)) {
             Result.AddError(TEXT("%d is not an valid enum value of %s"), IntValue, *Enum->CppType);
@@ -629,8 +623,7 @@ int64 UYamlSerialization::DeserializeEnumValue(const FYamlNode& Node, const UEnu
     }
 
     // Try to parse the Value as a String
-    if (Node.CanConvertTo<FString>()) {
-        const FString Name = Node.As<FString>();
+    if (FString Name; Node.TryAs(Name)) {
         const int64 Value = Enum->GetValueByNameString(Name);
 
         if (CheckEnums && Value == INDEX_NONE) {
@@ -3,8 +3,11 @@
 
 #pragma once
 
+#include "Containers/StringView.h"
 #include "node/convert.h"
 
+#include <string_view>
+
 static const TMap<FString, FColor> ColorMap = {
     {"Red", FColor::Red},
     {"Yellow", FColor::Yellow},
@@ -39,7 +42,9 @@ struct convert<FString> {
             return false;
         }
 
-        Out = UTF8_TO_TCHAR(Node.as<std::string>().c_str());
+        const std::string& Scalar = Node.Scalar();
+        const FUTF8ToTCHAR Converted(Scalar.data(), static_cast<int32>(Scalar.size()));
+        Out = FString(Converted.Length(), Converted.Get());
         return true;
     }
 };
@@ -56,7 +61,9 @@ struct convert<FName> {
             return false;
         }
 
-        Out = FName(Node.as<FString>());
+        const std::string& Scalar = Node.Scalar();
+        const FUTF8ToTCHAR Converted(Scalar.data(), static_cast<int32>(Scalar.size()));
+        Out = FName(Converted.Length(), Converted.Get());
         return true;
     }
 };
@@ -73,11 +80,58 @@ struct convert<FText> {
             return false;
         }
 
-        Out = FText::FromString(Node.as<FString>());
+        const std::string& Scalar = Node.Scalar();
+        const FUTF8ToTCHAR Converted(Scalar.data(), static_cast<int32>(Scalar.size()));
+        Out = FText::FromString(FString(Converted.Length(), Converted.Get()));
         return true;
     }
 };
 
+// encode an FUtf8StringView, e.g. to use it as a Key
+template<>
+struct convert<FUtf8StringView> {
+    static Node encode(const FUtf8StringView View) {
+        return Node(std::string(reinterpret_cast<const char*>(View.GetData()), View.Len()));
+    }
+};
+
+
+// Compare String Keys to the UTF-8 Bytes of the stored Keys, instead of decoding every stored Key.
+// FString and FName compare case-insensitive, just like their operator==
+namespace detail {
+// Converts the Key once and keeps the Bytes alive during the Lookup
+struct FUtf8KeyText {
+    FTCHARToUTF8 Conversion;
+
+    operator std::string_view() const {
+        return std::string_view(Conversion.Get(), Conversion.Length());
+    }
+};
+
+template<>
+struct key_text<FString> {
+    static constexpr bool value = true;
+    static constexpr bool ignore_case = true;
+    static FUtf8KeyText get(const FString& Key) { return FUtf8KeyText{FTCHARToUTF8(*Key)}; }
+};
+
+template<>
+struct key_text<FName> {
+    static constexpr bool value = true;
+    static constexpr bool ignore_case = true;
+    static FUtf8KeyText get(const FName& Key) { return FUtf8KeyText{FTCHARToUTF8(*Key.ToString())}; }
+};
+
+template<>
+struct key_text<FUtf8StringView> {
+    static constexpr bool value = true;
+    static constexpr bool ignore_case = false;
+    static std::string_view get(const FUtf8StringView Key) {
+        return std::string_view(reinterpret_cast<const char*>(Key.GetData()), Key.Len());
+    }
+};
+}
+
 // encode FColor and FLinearColor as Vector or String
 template<>
 struct convert<FColor> {
@@ -94,8 +148,9 @@ struct convert<FColor> {
 
     static bool decode(const Node& Node, FColor& Out) {
         if (Node.Type() == NodeType::Scalar) {
+            const FString Name = UTF8_TO_TCHAR(Node.Scalar().c_str());
             for (const auto& Pair : ColorMap) {
-                if (Node.as<FString>() == Pair.Key) {
+                if (Name == Pair.Key) {
                     Out = Pair.Value;
                     return true;
                 }
@@ -108,8 +163,12 @@ struct convert<FColor> {
         }
 
 
-        const float A = Node.size() == 4 ? Node[3].as<uint8>() : 1.f;
-        Out = FColor(Node[0].as<uint8>(), Node[1].as<uint8>(), Node[2].as<uint8>(), A);
+        uint8 R, G, B, A = 1;
+        if (!Node[0].try_as(R) || !Node[1].try_as(G) || !Node[2].try_as(B) || (Node.size() == 4 && !Node[3].try_as(A))) {
+            return false;
+        }
+
+        Out = FColor(R, G, B, A);
         return true;
     }
 };
@@ -145,14 +204,12 @@ struct convert2dBase {
 
     static bool decode(const Node& Node, ContainerType<InnerType>& Out) {
         if (Node.IsSequence() && Node.size() == 2) {
-            Out.X = Node[0].as<InnerType>();
-            Out.Y = Node[1].as<InnerType>();
-            return true;
+            return Node[0].try_as(Out.X) && Node[1].try_as(Out.Y);
         }
 
         // Constant Vector
-        if (Node.IsScalar()) {
-            Out.X = Out.Y = Node.as<InnerType>();
+        if (Node.IsScalar() && Node.try_as(Out.X)) {
+            Out.Y = Out.X;
         }
 
         return false;
@@ -174,15 +231,12 @@ struct convert3dBase {
 
     static bool decode(const Node& Node, ContainerType<InnerType>& Out) {
         if (Node.IsSequence() && Node.size() == 3) {
-            Out.X = Node[0].as<InnerType>();
-            Out.Y = Node[1].as<InnerType>();
-            Out.Z = Node[2].as<InnerType>();
-            return true;
+            return Node[0].try_as(Out.X) && Node[1].try_as(Out.Y) && Node[2].try_as(Out.Z);
         }
 
         // Constant Vector
-        if (Node.IsScalar()) {
-            Out.X = Out.Y = Out.Z = Node.as<InnerType>();
+        if (Node.IsScalar() && Node.try_as(Out.X)) {
+            Out.Y = Out.Z = Out.X;
         }
 
         return false;
@@ -204,16 +258,12 @@ struct convert4dBase {
 
     static bool decode(const Node& Node, ContainerType<InnerType>& Out) {
         if (Node.IsSequence() && Node.size() == 4) {
-            Out.X = Node[0].as<InnerType>();
-            Out.Y = Node[1].as<InnerType>();
-            Out.Z = Node[2].as<InnerType>();
-            Out.W = Node[3].as<InnerType>();
-            return true;
+            return Node[0].try_as(Out.X) && Node[1].try_as(Out.Y) && Node[2].try_as(Out.Z) && Node[3].try_as(Out.W);
         }
 
         // Constant Vector
-        if (Node.IsScalar()) {
-            Out.X = Out.Y = Out.Z = Out.W = Node.as<InnerType>();
+        if (Node.IsScalar() && Node.try_as(Out.X)) {
+            Out.Y = Out.Z = Out.W = Out.X;
         }
 
         return false;
@@ -262,15 +312,12 @@ struct convert<UE::Math::TQuat<FloatType>> {
     static bool decode(const Node& Node, UE::Math::TQuat<FloatType>& Out) {
         if (Node.IsSequence()) {
             if (Node.size() == 4) {
-                Out.X = Node[0].as<FloatType>();
-                Out.Y = Node[1].as<FloatType>();
-                Out.Z = Node[2].as<FloatType>();
-                Out.W = Node[3].as<FloatType>();
-                return true;
+                return Node[0].try_as(Out.X) && Node[1].try_as(Out.Y) && Node[2].try_as(Out.Z) && Node[3].try_as(Out.W);
             }
 
-            if (Node.size() == 3) {
-                Out = Node.as<UE::Math::TRotator<FloatType>>().Quaternion();
+            UE::Math::TRotator<FloatType> Rotator;
+            if (Node.size() == 3 && Node.try_as(Rotator)) {
+                Out = Rotator.Quaternion();
                 return true;
             }
         }
@@ -339,9 +386,15 @@ struct convert<UE::Math::TTransform<FloatType>> {
             return false;
         }
 
-        Out.SetTranslation(Node[0].as<UE::Math::TVector<FloatType>>());
-        Out.SetRotation(Node[1].as<UE::Math::TQuat<FloatType>>());
-        Out.SetScale3D(Node[2].as<UE::Math::TVector<FloatType>>());
+        UE::Math::TVector<FloatType> Translation, Scale;
+        UE::Math::TQuat<FloatType> Rotation;
+        if (!Node[0].try_as(Translation) || !Node[1].try_as(Rotation) || !Node[2].try_as(Scale)) {
+            return false;
+        }
+
+        Out.SetTranslation(Translation);
+        Out.SetRotation(Rotation);
+        Out.SetScale3D(Scale);
         return true;
     }
 };
@@ -361,11 +414,7 @@ struct convert<UE::Math::TRotator<FloatType>> {
 
     static bool decode(const Node& Node, UE::Math::TRotator<FloatType>& Out) {
         if (Node.IsSequence() && Node.size() == 3) {
-            Out.Pitch = Node[0].as<FloatType>();
-            Out.Yaw = Node[1].as<FloatType>();
-            Out.Roll = Node[2].as<FloatType>();
-
-            return true;
+            return Node[0].try_as(Out.Pitch) && Node[1].try_as(Out.Yaw) && Node[2].try_as(Out.Roll);
         }
 
         return false;
@@ -390,7 +439,11 @@ struct convert<TArray<InnerType>> {
 
         Out = {};
         for (const_iterator Iterator = Node.begin(); Iterator != Node.end(); ++Iterator) {
-            Out.Add(Iterator->as<InnerType>());
+            InnerType Element;
+            if (!Iterator->try_as(Element)) {
+                return false;
+            }
+            Out.Add(MoveTemp(Element));
         }
 
         return true;
@@ -415,7 +468,11 @@ struct convert<TSet<InnerType>> {
 
         Out = {};
         for (const_iterator Iterator = Node.begin(); Iterator != Node.end(); ++Iterator) {
-            Out.Add(Iterator->as<InnerType>());
+            InnerType Element;
+            if (!Iterator->try_as(Element)) {
+                return false;
+            }
+            Out.Add(MoveTemp(Element));
         }
 
         return true;
@@ -441,7 +498,12 @@ struct convert<TMap<KeyType, ValueType>> {
 
         Out = {};
         for (const_iterator Iterator = Node.begin(); Iterator != Node.end(); ++Iterator) {
-            Out.Add(Iterator->first.as<KeyType>(), Iterator->second.as<ValueType>());
+            KeyType Key;
+            ValueType Value;
+            if (!Iterator->first.try_as(Key) || !Iterator->second.try_as(Value)) {
+                return false;
+            }
+            Out.Add(MoveTemp(Key), MoveTemp(Value));
         }
 
         return true;
@@ -0,0 +1,176 @@
+﻿// Copyright (c) 2021-2026, Forschungszentrum Jülich GmbH. All rights reserved.
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Enums.h"
+#include "Containers/StringView.h"
+
+#include <string>
+#include <string_view>
+
+class FYamlDocument;
+struct FYamlKey;
+struct FYamlNode;
+
+
+/** One Node on the Tape of a FYamlDocument */
+struct FYamlTapeEntry {
+    enum class EKind : uint8 {
+        Null,
+        Scalar,
+        Sequence,
+        Map,
+
+        // Refers to the anchored Entry at Offset
+        Alias
+    };
+
+    /** Scalar: Position of the Text in the String Buffer. Sequence and Map: Index of the first Entry after them.
+     * Alias: Index of the anchored Entry */
+    uint32 Offset = 0;
+
+    /** Scalar: Length of the Text in Bytes. Sequence: Number of Elements. Map: Number of Key-Value Pairs */
+    uint32 Size = 0;
+
+    /** Index into the Tags of the Document, 0 if there is none */
+    uint32 Tag = 0;
+
+    EKind Kind = EKind::Null;
+    EYamlEmitterStyle Style = EYamlEmitterStyle::Default;
+
+    /** If an Alias refers to this Entry */
+    bool bAnchored = false;
+};
+
+
+/**
+ * Points to a Node inside a FYamlDocument. Cursors are small and cheap to copy; they are only valid as long as the
+ * Document they were created from.
+ *
+ * Aliases are followed transparently. Navigating to something that does not exist yields an invalid Cursor, on which
+ * all further Navigation yields invalid Cursors as well.
+ */
+class UNREALYAML_API FYamlCursor {
+public:
+    FYamlCursor() = default;
+
+    bool IsValid() const {
+        return Document != nullptr;
+    }
+
+    /** Undefined for an invalid Cursor */
+    EYamlNodeType Type() const;
+
+    bool IsNull() const {
+        return Type() == EYamlNodeType::Empty;
+    }
+
+    bool IsScalar() const {
+        return Type() == EYamlNodeType::Scalar;
+    }
+
+    bool IsSequence() const {
+        return Type() == EYamlNodeType::Sequence;
+    }
+
+    bool IsMap() const {
+        return Type() == EYamlNodeType::Map;
+    }
+
+    /** Number of Elements of a Sequence or Key-Value Pairs of a Map, 0 otherwise */
+    int32 Size() const;
+
+    /** The UTF-8 Text of a Scalar, without copying it. Empty for all other Nodes */
+    FUtf8StringView GetScalar() const;
+
+    /** The Text of a Scalar, empty for all other Nodes */
+    FString Scalar() const;
+
+    /** An empty Tag or "?" means none was given, "!" marks a quoted or block Scalar without Tag */
+    FUtf8StringView GetTag() const;
+
+    /** The first Element of a Sequence or the first Key of a Map */
+    FYamlCursor First() const;
+
+    /** The next Node inside the same Sequence or Map. In a Map, Keys and Values alternate */
+    FYamlCursor Next() const;
+
+    /** The Element at the given Index of a Sequence */
+    FYamlCursor operator[](int32 Index) const;
+
+    /** The Value at the given Key of a Map. Like an FString Key, it matches regardless of the Case of ASCII Letters */
+    FYamlCursor operator[](const FString& Key) const;
+
+    /** The Value at the given Key of a Map. The Key has to match exactly */
+    FYamlCursor operator[](FUtf8StringView Key) const;
+
+    /** The Value at the given Key of a Map. Like an FString Key, it matches regardless of the Case of ASCII Letters */
+    FYamlCursor operator[](const FYamlKey& Key) const;
+
+    /** Builds a FYamlNode with the Contents of this Node, e.g. to use the Conversions of FYamlNode */
+    FYamlNode ToNode() const;
+
+private:
+    friend FYamlDocument;
+
+    FYamlCursor(const FYamlDocument* InDocument, uint32 InPosition, uint32 InParentEnd);
+
+    const FYamlTapeEntry& Entry() const;
+    FYamlCursor FindKey(std::string_view Key, bool bIgnoreCase) const;
+
+    const FYamlDocument* Document = nullptr;
+
+    // Position on the Tape, Index of the Entry after following an Alias, End of the Sequence or Map it is part of
+    uint32 Position = 0;
+    uint32 Index = 0;
+    uint32 ParentEnd = 0;
+};
+
+
+/**
+ * A parsed YAML Document that can only be read.
+ *
+ * Instead of a Graph of individually allocated Nodes like FYamlNode, the Document is stored as one contiguous Tape of
+ * small fixed-size Entries in Document order, plus a single Buffer with the Text of all Scalars. Sequences and Maps
+ * store where they end, so Cursors skip over them in constant time. This takes a fraction of the Memory of a
+ * FYamlNode and is much faster to walk. Use it for large Configs that are only read; ToNode() converts any Part of it
+ * into a FYamlNode on demand.
+ *
+ * Only the first Document of the Input is read.
+ */
+class UNREALYAML_API FYamlDocument {
+public:
+    /** @returns If the Parsing was successful */
+    static bool Parse(const FString& String, FYamlDocument& Out);
+
+    /** Parses UTF-8 encoded Text in place. It does not need to be null-terminated.
+     *
+     * @returns If the Parsing was successful */
+    static bool Parse(FUtf8StringView String, FYamlDocument& Out);
+
+    /** @returns If the File exists and the Parsing was successful */
+    static bool LoadFromFile(const FString& Path, FYamlDocument& Out);
+
+    /** The Root Node, invalid if the Document is empty */
+    FYamlCursor Root() const;
+
+    /** Number of Nodes on the Tape */
+    int32 Num() const {
+        return Tape.Num();
+    }
+
+    /** Memory allocated for the Tape, the Text and the Tags */
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    friend FYamlCursor;
+    friend class FYamlTapeBuilder;
+
+    TArray<FYamlTapeEntry> Tape;
+    TArray<UTF8CHAR> Strings;
+
+    // Each distinct Tag once, starting with the empty one
+    TArray<std::string> Tags;
+};
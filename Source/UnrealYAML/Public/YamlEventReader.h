@@ -0,0 +1,149 @@
+﻿// Copyright (c) 2021-2026, Forschungszentrum Jülich GmbH. All rights reserved.
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Enums.h"
+#include "Containers/StringView.h"
+
+struct FYamlNode;
+
+
+/** A Position inside the parsed Text. All values start at 0 */
+struct UNREALYAML_API FYamlMark {
+    /** Offset in Bytes (or Characters, if the Input was UTF-16 or UTF-32) */
+    int32 Position = 0;
+    int32 Line = 0;
+    int32 Column = 0;
+};
+
+
+/** How reading an Event Stream ended */
+enum class EYamlReadResult : uint8 {
+    // All Documents have been read
+    Finished,
+
+    // The Handler returned false from one of the Events
+    Aborted,
+
+    // The Input is not valid YAML or could not be opened. The Handler received an OnError before
+    Failed
+};
+
+
+/**
+ * Receives the contents of a YAML Stream as a sequence of Events (SAX-style), without building any Nodes.
+ *
+ * Every Event returns whether reading should continue, so a Handler can stop as soon as it found what it is looking
+ * for. Strings are only valid for the duration of the call; use FYamlEventReader::ToString to keep them.
+ * Anchors are numbered in order of appearance, 0 meaning no Anchor.
+ */
+class UNREALYAML_API IYamlEventHandler {
+public:
+    virtual ~IYamlEventHandler() = default;
+
+    virtual bool OnDocumentStart(const FYamlMark& Mark) { return true; }
+    virtual bool OnDocumentEnd() { return true; }
+
+    virtual bool OnNull(const FYamlMark& Mark, uint64 Anchor) { return true; }
+    virtual bool OnAlias(const FYamlMark& Mark, uint64 Anchor) { return true; }
+
+    /** The Name of an Anchor, called right before the Node it belongs to */
+    virtual bool OnAnchor(const FYamlMark& Mark, FUtf8StringView Name) { return true; }
+
+    /** An empty Tag or "?" means none was given, "!" marks a quoted or block Scalar without Tag */
+    virtual bool OnScalar(const FYamlMark& Mark, FUtf8StringView Tag, uint64 Anchor, FUtf8StringView Value) {
+        return true;
+    }
+
+    virtual bool OnSequenceStart(const FYamlMark& Mark, FUtf8StringView Tag, uint64 Anchor, EYamlEmitterStyle Style) {
+        return true;
+    }
+    virtual bool OnSequenceEnd() { return true; }
+
+    virtual bool OnMapStart(const FYamlMark& Mark, FUtf8StringView Tag, uint64 Anchor, EYamlEmitterStyle Style) {
+        return true;
+    }
+    virtual bool OnMapEnd() { return true; }
+
+    /** Called once if the Input is malformed, no further Events will follow */
+    virtual void OnError(const FYamlMark& Mark, const FString& Message) {}
+};
+
+
+/**
+ * Streams the Events of all Documents in a YAML Input to an IYamlEventHandler.
+ *
+ * Unlike UYamlParsing, no Node Graph is built, so the memory used does not grow with the size of the Input
+ * (apart from the Input itself, if it is already in memory).
+ */
+class UNREALYAML_API FYamlEventReader {
+public:
+    static EYamlReadResult Read(const FString& String, IYamlEventHandler& Handler);
+
+    /** Reads UTF-8 encoded Text in place. It does not need to be null-terminated */
+    static EYamlReadResult Read(FUtf8StringView String, IYamlEventHandler& Handler);
+
+    /**
+     * Reads a File. It is memory-mapped where the platform supports it and otherwise read in small blocks,
+     * so it is never loaded as a whole.
+     */
+    static EYamlReadResult ReadFile(const FString& Path, IYamlEventHandler& Handler);
+
+    /** Converts a String of an Event to a FString */
+    static FString ToString(FUtf8StringView Text);
+};
+
+
+/**
+ * Parses YAML that arrives in Chunks, e.g. from a Socket or asynchronous File reads, so Parsing overlaps with
+ * receiving the rest of the Input.
+ *
+ * A Document is handled as soon as it is closed by the "---" or "..." marker that follows it. Chunks may end anywhere,
+ * even in the middle of a Token or a UTF-8 Character; only the Document that is still open is buffered.
+ * The yaml-cpp Parser cannot be suspended inside a Document, so all Events of a Document are delivered once it is
+ * complete. Directives like %TAG apply to all Documents after them, so once one is seen, the rest of the Input is
+ * buffered and handled by Finish() as a whole. The Input must be UTF-8.
+ */
+class UNREALYAML_API FYamlPushParser {
+public:
+    /** Streams the Events of each Document to the Handler, which must outlive the Parser */
+    explicit FYamlPushParser(IYamlEventHandler& InHandler);
+
+    /** Builds a Node for each Document */
+    explicit FYamlPushParser(TFunction<void(const FYamlNode& Document)> InOnDocument);
+
+    /**
+     * Appends a Chunk of the Input and handles all Documents it completes.
+     *
+     * @returns false once Parsing has stopped because of an Error or because the Handler aborted */
+    bool Feed(TArrayView<const uint8> Chunk);
+
+    /** Marks the end of the Input and handles the last Document */
+    EYamlReadResult Finish();
+
+    /** Describes why Parsing failed, if it did */
+    const FString& GetError() const { return Error; }
+
+private:
+    bool ScanLines(bool bFinal);
+    bool Flush(int32 End);
+    void Discard(int32 End);
+
+    IYamlEventHandler* Handler = nullptr;
+    TFunction<void(const FYamlNode&)> OnDocument;
+
+    // The open Document, followed by an incomplete Line
+    TArray<uint8> Buffer;
+    // Start of the first Line in the Buffer that has not been checked for Document markers yet
+    int32 ScanOffset = 0;
+    // Position of the Buffer in the whole Input
+    FYamlMark Origin;
+    bool bDocumentOpen = false;
+    // Set once a Directive was seen, after which the Input is no longer split into Documents
+    bool bAfterDirective = false;
+
+    EYamlReadResult Result = EYamlReadResult::Finished;
+    FString Error;
+};
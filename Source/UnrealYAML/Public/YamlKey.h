@@ -0,0 +1,64 @@
+﻿// Copyright (c) 2021-2026, Forschungszentrum Jülich GmbH. All rights reserved.
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "node/convert.h"
+
+#include <string>
+#include <string_view>
+
+
+/**
+ * A Key to look up Values in Map Nodes, whose UTF-8 Bytes and Hash are computed only once.
+ *
+ * Keys that are read from many Nodes, e.g. every Frame, should be created once and reused:
+ *
+ *     static const FYamlKey Damage(TEXT("damage"));
+ *     const float Value = Node[Damage].As<float>();
+ *
+ * Like an FString Key, it matches regardless of the Case of ASCII Letters.
+ */
+struct UNREALYAML_API FYamlKey {
+    explicit FYamlKey(const TCHAR* Key);
+    explicit FYamlKey(const FString& Key);
+    explicit FYamlKey(FUtf8StringView Key);
+
+    /** The UTF-8 encoded Key */
+    std::string_view GetUtf8() const {
+        return Utf8;
+    }
+
+    /** The Hash the Key is looked up with in the Index of large Maps */
+    std::size_t GetHash() const {
+        return Hash;
+    }
+
+    FString ToString() const;
+
+private:
+    std::string Utf8;
+    std::size_t Hash;
+};
+
+
+namespace YAML {
+// encode an FYamlKey, so a missing Key can be inserted
+template<>
+struct convert<FYamlKey> {
+    static Node encode(const FYamlKey& Key) {
+        return Node(std::string(Key.GetUtf8()));
+    }
+};
+
+namespace detail {
+template<>
+struct key_text<FYamlKey> {
+    static constexpr bool value = true;
+    static constexpr bool ignore_case = true;
+    static hashed_key_text get(const FYamlKey& Key) { return {Key.GetUtf8(), Key.GetHash()}; }
+};
+}
+}
@@ -6,11 +6,31 @@
 #include "CoreMinimal.h"
 #include "yaml.h"
 #include "UnrealTypes.h"
+#include "YamlKey.h"
 #include "Enums.h"
 #include "Emitter.h"
+#include "YamlEventReader.h"
 
 #include "YamlNode.generated.h"
 
+class FYamlElements;
+class FYamlPairs;
+struct FYamlNodeRef;
+
+/** Memory held by the Nodes of a Document, see FYamlNode::GetMemoryStats() */
+struct UNREALYAML_API FYamlMemoryStats {
+    /** All Nodes of the Document, including Keys and Nodes that are no longer reachable */
+    int64 Nodes = 0;
+
+    /** The Text of all Scalars */
+    int64 ScalarBytes = 0;
+
+    /** The Members of Sequences and Maps, including the Key Indexes of large Maps */
+    int64 ContainerBytes = 0;
+
+    /** All of the above, plus the Nodes themselves */
+    int64 AllocatedBytes = 0;
+};
 
 /** A wrapper for the Yaml Node class. Base YAML class. Stores a YAML-Structure in a Tree-like hierarchy.
  * Can therefore either hold a single value or be a Container for other Nodes.
@@ -23,6 +43,7 @@ struct UNREALYAML_API FYamlNode {
 private:
     friend void operator<<(std::ostream& Out, const FYamlNode& Node);
     friend void operator<<(FYamlEmitter& Out, const FYamlNode& Node);
+    friend struct FYamlPath;
 
     /** Forward Input Iterator Base to iterate over Nodes.
      *
@@ -71,9 +92,17 @@ private:
         }
 
 
-        /** The Arrow Operator yields a Pointer to the Value */
-        TPair<NodeType, NodeType>* operator->() const {
-            return &MakeTuple(Key(), Value());
+        /** The Arrow Operator yields a Pointer to the Key-Value Pair, which lives as long as the returned Proxy */
+        struct FProxy {
+            TPair<NodeType, NodeType> Pair;
+
+            TPair<NodeType, NodeType>* operator->() {
+                return &Pair;
+            }
+        };
+
+        FProxy operator->() const {
+            return FProxy{MakeTuple(Key(), Value())};
         }
 
 
@@ -87,7 +116,6 @@ private:
         TIteratorBase operator++(int) {
             TIteratorBase Pre(*this);
             ++(*this);
-            Index++;
             return Pre;
         }
 
@@ -179,6 +207,10 @@ public:
     
     /** Sets a tag on this Node */
     void SetTag(const FString& Tag);
+
+    // Position ------------------------------------------------------------------------
+    /** Returns where the Node starts in the Text it was parsed from */
+    FYamlMark Mark() const;
     
 
     // Assignment ----------------------------------------------------------------------
@@ -212,19 +244,68 @@ public:
      */
     bool Reset(const FYamlNode& Other = FYamlNode());
 
+    // Snapshots -----------------------------------------------------------------------
+    /** Returns a deep Copy of this Node, which can be modified without affecting this one.
+     *
+     * Assigning a FYamlNode only creates another Reference to the same Node. A Node that appears in several Places,
+     * like an Anchor and its Aliases, is shared by all of them in the Copy as well.
+     *
+     * @param bPreserveAliases If false, each Place gets a Copy of its own instead, which is faster for large Trees.
+     * Nested Aliases multiply the Size of such a Copy with every Level, so once it grows far beyond the Source, the
+     * Aliases are preserved after all */
+    FYamlNode Clone(bool bPreserveAliases = true) const;
+
+    /** Returns an immutable Copy of this Node, e.g. to share a parsed Config between Threads.
+     *
+     * All const Operations on the Copy only read it, so it can be used from any number of Threads at once, as long
+     * as each Thread uses its own FYamlNode Objects. This includes assigning it or its Nodes into other Trees, which
+     * only reference it. Missing Keys are never inserted into it, and any Attempt to modify it, like assigning to one
+     * of its Nodes, asserts. */
+    FYamlNode Freeze() const;
+
+    /** If this Node belongs to a Snapshot created by Freeze() */
+    bool IsFrozen() const {
+        return Node.IsFrozen();
+    }
+
+    // Diagnostics ---------------------------------------------------------------------
+    /** Measures the Memory of the Document this Node belongs to.
+     *
+     * Nodes assigned into each other share their Memory, so this covers everything that was ever merged into the
+     * Document, not only the Subtree of this Node. It visits every Node, so it is not meant to be called every Frame;
+     * the Totals of all Documents are published to the "UnrealYAML" Stat Group instead. */
+    FYamlMemoryStats GetMemoryStats() const;
+
 
     // Access --------------------------------------------------------------------------
+    /** Try to Convert the Contents of the Node to the Given Type, without throwing any Exception on failure.
+     *
+     * Failed Conversions are as cheap as successful ones, so this is the Way to probe optional or mixed-type Values.
+     * Exceptions thrown by a custom Decoder itself (e.g. one using as<T>() inside) are caught and count as failure.
+     *
+     * @param Out Receives the Converted Value, it is left unchanged if the Conversion was unsuccessful
+     * @return If the Conversion was successful
+     */
+    template<typename T>
+    bool TryAs(T& Out) const {
+        try {
+            return Node.try_as(Out);
+        } catch (YAML::Exception&) {
+            return false;
+        }
+    }
+
     /** Try to Convert the Contents of the Node to the Given Type or a nullptr when conversion is not possible
      *
      * @return A Pointer to the Converted Value. If the Conversion was unsuccessful, return a nullptr
      */
     template<typename T>
     TOptional<T> AsOptional() const {
-        try {
-            return Node.as<T>();
-        } catch (YAML::Exception) {
-            return {};
+        T Value;
+        if (TryAs(Value)) {
+            return MoveTemp(Value);
         }
+        return {};
     }
 
     /** Try to Convert the Contents of the Node to the Given Type or return the Default Value
@@ -237,27 +318,39 @@ public:
      */
     template<typename T>
     T As(T DefaultValue = T()) const {
-        try {
-            return Node.as<T>();
-        } catch (YAML::Exception) {
-            return DefaultValue;
-        }
+        TryAs(DefaultValue);
+        return DefaultValue;
     }
 
     /** Check if the given node can be converted to the given Type */
     template<typename T>
     bool CanConvertTo() const {
-        try {
-            Node.as<T>();
-            return true;
-        } catch (YAML::Exception) {
-            return false;
-        }
+        T Value;
+        return TryAs(Value);
     }
 
     /** Try to Content of the Node if it is a Scalar */
     FString Scalar() const;
 
+    /** The UTF-8 Text of a Scalar, without copying it. Empty for all other Nodes.
+     *
+     * It points into the Node itself, so it is only valid until the Node is modified */
+    FUtf8StringView ScalarView() const {
+        const std::string_view Text = ScalarUtf8();
+        return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Text.data()), static_cast<int32>(Text.size()));
+    }
+
+    /** Like ScalarView(), for Code that works with yaml-cpp or the Standard Library */
+    std::string_view ScalarUtf8() const;
+
+    /** If the Node is a Scalar with the given Text. Compares without creating an FString
+     *
+     * @param SearchCase IgnoreCase only ignores the Case of ASCII Letters, like String Keys do */
+    bool ScalarEquals(FStringView Text, ESearchCase::Type SearchCase = ESearchCase::CaseSensitive) const;
+
+    /** If the Node is a Scalar with the given UTF-8 Text, see ScalarEquals() */
+    bool ScalarEquals(FUtf8StringView Text, ESearchCase::Type SearchCase = ESearchCase::CaseSensitive) const;
+
     /** Returns the whole Content of the Node as a single FString */
     FString GetContent() const;
 
@@ -283,6 +376,28 @@ public:
         return Node.end();
     }
 
+    /** Iterates over the Elements of a Sequence, yielding their Index and Value without creating any Nodes:
+     *
+     *     for (const auto [Index, Value] : Node.Elements()) { ... }
+     *
+     * The Values are FYamlNodeRefs, which are only valid during the Loop. Empty if this Node is not a Sequence. */
+    FYamlElements Elements() const;
+
+    /** Iterates over the Key-Value Pairs of a Map without creating any Nodes:
+     *
+     *     for (const auto [Key, Value] : Node.Pairs()) { ... }
+     *
+     * The Keys and Values are FYamlNodeRefs, which are only valid during the Loop. Empty if this Node is not a Map. */
+    FYamlPairs Pairs() const;
+
+    /** Calls Callback(int32 Index, FYamlNodeRef Value) for each Element of a Sequence, see Elements() */
+    template<typename FunctorType>
+    void ForEachElement(FunctorType&& Callback) const;
+
+    /** Calls Callback(FYamlNodeRef Key, FYamlNodeRef Value) for each Key-Value Pair of a Map, see Pairs() */
+    template<typename FunctorType>
+    void ForEachPair(FunctorType&& Callback) const;
+
     // Sequence ------------------------------------------------------------------------
     /** Converts the Node to a Sequence and adds the Element to this list */
     template<typename T>
@@ -317,8 +432,8 @@ public:
         if (!IsMap()) return Ret;
         for (const auto Entry : Node) {
             T Key;
-            if (YAML::convert<T>::decode(Entry.first, Key)) {
-                Ret.Add(Entry.first.as<T>());
+            if (Entry.first.try_as(Key)) {
+                Ret.Add(MoveTemp(Key));
             }
         }
         return Ret;
@@ -343,6 +458,20 @@ public:
         return Node.remove(Key);
     }
 
+    /** Returns the Value at the given Key or Index, without inserting it if it does not exist.
+     *
+     * Use with a FYamlKey for Keys that are looked up repeatedly */
+    template<typename T>
+    TOptional<FYamlNode> Find(const T& Key) const {
+        try {
+            const YAML::Node Value = Node[Key];
+            if (Value.IsDefined()) {
+                return FYamlNode(Value);
+            }
+        } catch (YAML::Exception) {}
+        return {};
+    }
+
     /** Returns the Value at the given Key or Index */
     const FYamlNode operator[](const FYamlNode& Key) const {
         return FYamlNode(Node[Key.Node]);
@@ -357,8 +486,287 @@ public:
     bool Remove(const FYamlNode& Key) {
         return Node.remove(Key.Node);
     }
+
+    /** Returns the Value at the given Key or Index, without inserting it if it does not exist */
+    TOptional<FYamlNode> Find(const FYamlNode& Key) const {
+        return Find(Key.Node);
+    }
+};
+
+// Views -------------------------------------------------------------------------------
+
+/** A Reference to a Node inside a Document, as yielded by FYamlNode::Elements() and FYamlNode::Pairs().
+ *
+ * Unlike a FYamlNode, it does not share the Ownership of the Document, so creating and copying it costs nothing.
+ * In turn, it is only valid as long as the Node or View it was reached from, and until the Document is modified.
+ * Use ToNode() to keep it for longer.
+ */
+struct UNREALYAML_API FYamlNodeRef {
+    /** An empty Reference, which is not Defined */
+    FYamlNodeRef() = default;
+
+    FYamlNodeRef(const YAML::Node& InOwner, const YAML::detail::node* InPtr) :
+        Owner(&InOwner),
+        Ptr(InPtr) {}
+
+    // Types ---------------------------------------------------------------------------
+    /** Returns the Type of the referenced Data */
+    EYamlNodeType Type() const {
+        return Ptr ? static_cast<EYamlNodeType>(Ptr->type()) : EYamlNodeType::Undefined;
+    }
+
+    /** If the referenced Node has been Defined */
+    bool IsDefined() const {
+        return Ptr && Ptr->is_defined();
+    }
+
+    bool IsNull() const {
+        return Type() == EYamlNodeType::Null;
+    }
+
+    bool IsScalar() const {
+        return Type() == EYamlNodeType::Scalar;
+    }
+
+    bool IsSequence() const {
+        return Type() == EYamlNodeType::Sequence;
+    }
+
+    bool IsMap() const {
+        return Type() == EYamlNodeType::Map;
+    }
+
+    explicit operator bool() const {
+        return IsDefined();
+    }
+
+    /** Test if 2 References point to the same Node */
+    bool Is(const FYamlNodeRef& Other) const {
+        return Ptr && Other.Ptr && Ptr->is(*Other.Ptr);
+    }
+
+    bool operator==(const FYamlNodeRef& Other) const {
+        return Is(Other);
+    }
+
+    // Access --------------------------------------------------------------------------
+    /** Converts like FYamlNode::TryAs(), without throwing any Exception on failure */
+    template<typename T>
+    bool TryAs(T& Out) const {
+        try {
+            return Ptr && YAML::detail::node_access::make(*Owner, *Ptr).try_as(Out);
+        } catch (YAML::Exception&) {
+            return false;
+        }
+    }
+
+    /** Converts like FYamlNode::AsOptional() */
+    template<typename T>
+    TOptional<T> AsOptional() const {
+        T Value;
+        if (TryAs(Value)) {
+            return MoveTemp(Value);
+        }
+        return {};
+    }
+
+    /** Converts like FYamlNode::As() */
+    template<typename T>
+    T As(T DefaultValue = T()) const {
+        TryAs(DefaultValue);
+        return DefaultValue;
+    }
+
+    /** The Content of the Node if it is a Scalar */
+    FString Scalar() const;
+
+    /** The UTF-8 Text of a Scalar, without copying it, see FYamlNode::ScalarView() */
+    FUtf8StringView ScalarView() const {
+        const std::string_view Text = ScalarUtf8();
+        return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Text.data()), static_cast<int32>(Text.size()));
+    }
+
+    /** Like ScalarView(), for Code that works with yaml-cpp or the Standard Library */
+    std::string_view ScalarUtf8() const {
+        return Ptr && Ptr->type() == YAML::NodeType::Scalar ? std::string_view(Ptr->scalar()) : std::string_view();
+    }
+
+    /** If the Node is a Scalar with the given Text, see FYamlNode::ScalarEquals() */
+    bool ScalarEquals(FStringView Text, ESearchCase::Type SearchCase = ESearchCase::CaseSensitive) const;
+
+    /** If the Node is a Scalar with the given UTF-8 Text, see FYamlNode::ScalarEquals() */
+    bool ScalarEquals(FUtf8StringView Text, ESearchCase::Type SearchCase = ESearchCase::CaseSensitive) const;
+
+    /** Returns the Size of the Node if it is a Sequence or Map, 0 otherwise */
+    int32 Size() const {
+        return Ptr ? static_cast<int32>(Ptr->size()) : 0;
+    }
+
+    /** Iterates over the Elements of a referenced Sequence, see FYamlNode::Elements() */
+    FYamlElements Elements() const;
+
+    /** Iterates over the Key-Value Pairs of a referenced Map, see FYamlNode::Pairs() */
+    FYamlPairs Pairs() const;
+
+    /** Returns a FYamlNode for the referenced Node, which stays valid on its own */
+    FYamlNode ToNode() const {
+        return Ptr ? FYamlNode(YAML::detail::node_access::make(*Owner, *Ptr)) : FYamlNode();
+    }
+
+private:
+    const YAML::Node* Owner = nullptr;
+    const YAML::detail::node* Ptr = nullptr;
+};
+
+/** An Element of a Sequence, see FYamlNode::Elements() */
+struct FYamlElement {
+    int32 Index;
+    FYamlNodeRef Value;
+};
+
+/** A Key-Value Pair of a Map, see FYamlNode::Pairs() */
+struct FYamlPair {
+    FYamlNodeRef Key;
+    FYamlNodeRef Value;
+};
+
+/** Base of the Views returned by Elements() and Pairs(). Holds on to the iterated Node for as long as it is
+ * iterated, so it can also be used on a temporary FYamlNode. */
+template<typename ElementType>
+class TYamlNodeView {
+public:
+    class FIterator {
+    public:
+        FIterator(const YAML::Node& InOwner, const YAML::detail::const_node_iterator& Iter) :
+            Owner(&InOwner),
+            Iterator(Iter),
+            Index(0) {}
+
+        ElementType operator*() const;
+
+        /** The Arrow Operator yields a Pointer to the Element, which lives as long as the returned Proxy */
+        struct FProxy {
+            ElementType Element;
+
+            const ElementType* operator->() const {
+                return &Element;
+            }
+        };
+
+        FProxy operator->() const {
+            return FProxy{**this};
+        }
+
+        FIterator& operator++() {
+            ++Iterator;
+            Index++;
+            return *this;
+        }
+
+        bool operator==(const FIterator& Other) const {
+            return Iterator == Other.Iterator;
+        }
+
+        bool operator!=(const FIterator& Other) const {
+            return Iterator != Other.Iterator;
+        }
+
+    private:
+        const YAML::Node* Owner;
+        YAML::detail::const_node_iterator Iterator;
+        int32 Index;
+    };
+
+    TYamlNodeView(const YAML::Node& Iterated, const EYamlNodeType IteratedType) :
+        Node(Iterated) {
+        const YAML::detail::node* Ptr = YAML::detail::node_access::get(Node);
+        if (Ptr && static_cast<EYamlNodeType>(Ptr->type()) == IteratedType) {
+            Begin = Ptr->begin();
+            End = Ptr->end();
+        }
+    }
+
+    FIterator begin() const {
+        return FIterator(Node, Begin);
+    }
+
+    FIterator end() const {
+        return FIterator(Node, End);
+    }
+
+private:
+    YAML::Node Node;
+    YAML::detail::const_node_iterator Begin;
+    YAML::detail::const_node_iterator End;
+};
+
+template<>
+inline FYamlElement TYamlNodeView<FYamlElement>::FIterator::operator*() const {
+    return {Index, FYamlNodeRef(*Owner, (*Iterator).pNode)};
+}
+
+template<>
+inline FYamlPair TYamlNodeView<FYamlPair>::FIterator::operator*() const {
+    const auto Value = *Iterator;
+    return {FYamlNodeRef(*Owner, Value.first), FYamlNodeRef(*Owner, Value.second)};
+}
+
+/** View over the Elements of a Sequence, see FYamlNode::Elements() */
+class FYamlElements : public TYamlNodeView<FYamlElement> {
+public:
+    explicit FYamlElements(const YAML::Node& Node) :
+        TYamlNodeView(Node, EYamlNodeType::Sequence) {}
+};
+
+/** View over the Key-Value Pairs of a Map, see FYamlNode::Pairs() */
+class FYamlPairs : public TYamlNodeView<FYamlPair> {
+public:
+    explicit FYamlPairs(const YAML::Node& Node) :
+        TYamlNodeView(Node, EYamlNodeType::Map) {}
 };
 
+inline FYamlElements FYamlNode::Elements() const {
+    return FYamlElements(Node);
+}
+
+inline FYamlPairs FYamlNode::Pairs() const {
+    return FYamlPairs(Node);
+}
+
+template<typename FunctorType>
+void FYamlNode::ForEachElement(FunctorType&& Callback) const {
+    const YAML::detail::node* Ptr = YAML::detail::node_access::get(Node);
+    if (!Ptr || Ptr->type() != YAML::NodeType::Sequence) {
+        return;
+    }
+
+    int32 Index = 0;
+    for (auto It = Ptr->begin(), End = Ptr->end(); It != End; ++It) {
+        Callback(Index++, FYamlNodeRef(Node, (*It).pNode));
+    }
+}
+
+template<typename FunctorType>
+void FYamlNode::ForEachPair(FunctorType&& Callback) const {
+    const YAML::detail::node* Ptr = YAML::detail::node_access::get(Node);
+    if (!Ptr || Ptr->type() != YAML::NodeType::Map) {
+        return;
+    }
+
+    for (auto It = Ptr->begin(), End = Ptr->end(); It != End; ++It) {
+        const auto Pair = *It;
+        Callback(FYamlNodeRef(Node, Pair.first), FYamlNodeRef(Node, Pair.second));
+    }
+}
+
+inline FYamlElements FYamlNodeRef::Elements() const {
+    return FYamlElements(Ptr ? YAML::detail::node_access::make(*Owner, *Ptr) : YAML::Node());
+}
+
+inline FYamlPairs FYamlNodeRef::Pairs() const {
+    return FYamlPairs(Ptr ? YAML::detail::node_access::make(*Owner, *Ptr) : YAML::Node());
+}
+
 // Global Variables --------------------------------------------------------------------
 
 /** Write the Contents of the Node to an OutputStream */
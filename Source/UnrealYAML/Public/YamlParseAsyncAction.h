@@ -0,0 +1,45 @@
+﻿// Copyright (c) 2021-2026, Forschungszentrum Jülich GmbH. All rights reserved.
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "YamlNode.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+
+#include "YamlParseAsyncAction.generated.h"
+
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FYamlParseAsyncResult, const FYamlNode&, Node, const FString&, Error);
+
+
+/** Latent Blueprint Nodes that Parse YAML on a worker Thread and continue on the Game Thread once it is done */
+UCLASS()
+class UNREALYAML_API UYamlParseAsyncAction final : public UBlueprintAsyncActionBase {
+    GENERATED_BODY()
+
+public:
+    /** Called with the parsed Node */
+    UPROPERTY(BlueprintAssignable)
+    FYamlParseAsyncResult OnSuccess;
+
+    /** Called with a description of the Error if the Parsing failed */
+    UPROPERTY(BlueprintAssignable)
+    FYamlParseAsyncResult OnFailure;
+
+    /** Parses a String into a YAML Node without blocking the Game Thread */
+    UFUNCTION(BlueprintCallable, Category = "YAML",
+        meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UYamlParseAsyncAction* ParseYamlAsync(UObject* WorldContextObject, const FString& String);
+
+    /** Reads a File and Parses the Contents into a YAML Node without blocking the Game Thread */
+    UFUNCTION(BlueprintCallable, Category = "YAML",
+        meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UYamlParseAsyncAction* LoadYamlFromFileAsync(UObject* WorldContextObject, const FString& Path);
+
+    virtual void Activate() override;
+
+private:
+    FString Input;
+    bool bIsFile = false;
+};
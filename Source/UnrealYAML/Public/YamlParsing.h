@@ -5,12 +5,31 @@
 
 #include "CoreMinimal.h"
 #include "YamlNode.h"
+#include "Async/Future.h"
+#include "Containers/StringView.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "Templates/ValueOrError.h"
+
+#include <string_view>
+
 #include "YamlParsing.generated.h"
 
 
 DECLARE_LOG_CATEGORY_EXTERN(LogYamlParsing, Log, All)
 
+
+/** Diagnostics on how the contents of a File made their way into the Parser */
+struct UNREALYAML_API FYamlFileLoadStats {
+    /** Bytes parsed in place from a memory-mapped region of the File */
+    int64 BytesMapped = 0;
+
+    /** Bytes that had to be read into an intermediate buffer, because the File could not be mapped */
+    int64 BytesCopied = 0;
+};
+
+/** The parsed Node, or a description of why Parsing failed */
+using FYamlParseResult = TValueOrError<FYamlNode, FString>;
+
 UCLASS(BlueprintType)
 class UNREALYAML_API UYamlParsing final : public UBlueprintFunctionLibrary {
     GENERATED_BODY()
@@ -21,7 +40,47 @@ public:
      *
      * @returns If the Parsing was successful */
     UFUNCTION(BlueprintCallable, Category = "YAML")
-    static bool ParseYaml(const FString String, FYamlNode& Out);
+    static bool ParseYaml(const FString& String, FYamlNode& Out);
+
+    /**
+     * Parses UTF-8 encoded Text into a YAML Node, without converting it to a FString first.
+     * The Text is read in place and does not need to be null-terminated.
+     *
+     * @returns If the Parsing was successful */
+    static bool ParseYaml(FUtf8StringView String, FYamlNode& Out);
+
+    /**
+     * Parses UTF-8 encoded Bytes into a YAML Node, e.g. the raw contents of a File or Archive.
+     * A UTF-16 or UTF-32 Byte Order Mark is respected.
+     *
+     * @returns If the Parsing was successful */
+    static bool ParseYaml(TArrayView<const uint8> Bytes, FYamlNode& Out);
+
+    /**
+     * Parses UTF-8 encoded Text into a YAML Node, without converting it to a FString first.
+     *
+     * @returns If the Parsing was successful */
+    static bool ParseYaml(std::string_view String, FYamlNode& Out);
+
+    /** Parses a null-terminated UTF-8 String into a YAML Node. Resolves the ambiguity for String Literals. */
+    static bool ParseYaml(const ANSICHAR* String, FYamlNode& Out) {
+        return ParseYaml(std::string_view(String), Out);
+    }
+
+    /**
+     * Parses all Documents of a String into YAML Nodes, in the order they appear.
+     *
+     * The Documents are parsed in parallel on the Task Graph, which pays off for Streams of many Documents.
+     *
+     * @returns If the Parsing of all Documents was successful */
+    UFUNCTION(BlueprintCallable, Category = "YAML")
+    static bool ParseAllYaml(const FString& String, TArray<FYamlNode>& Out);
+
+    /**
+     * Parses all Documents of UTF-8 encoded Bytes into YAML Nodes in parallel, in the order they appear.
+     *
+     * @returns If the Parsing of all Documents was successful */
+    static bool ParseAllYaml(TArrayView<const uint8> Bytes, TArray<FYamlNode>& Out);
 
     /**
      * Opens a File and Parses the Contents into a YAML Node.
@@ -30,6 +89,29 @@ public:
     UFUNCTION(BlueprintCallable, Category = "YAML")
     static bool LoadYamlFromFile(const FString Path, FYamlNode& Out);
 
+    /**
+     * Opens a File and Parses the Contents into a YAML Node.
+     *
+     * The File is memory-mapped and parsed in place where the platform supports it, otherwise its raw bytes are
+     * read into a buffer. In both cases, the Contents are never converted to a FString.
+     *
+     * @param Stats Receives how many bytes were mapped or copied
+     * @returns If the File Exists and the Parsing was successful */
+    static bool LoadYamlFromFile(const FString Path, FYamlNode& Out, FYamlFileLoadStats& Stats);
+
+    /**
+     * Parses a String into a YAML Node on a worker Thread.
+     *
+     * Use UYamlParseAsyncAction in Blueprints. */
+    static TFuture<FYamlParseResult> ParseYamlAsync(FString String);
+
+    /**
+     * Reads a File and Parses the Contents into a YAML Node on a worker Thread, so neither the I/O nor the Parsing
+     * blocks the calling Thread.
+     *
+     * Use UYamlParseAsyncAction in Blueprints. */
+    static TFuture<FYamlParseResult> LoadYamlFromFileAsync(FString Path);
+
     /**
      * Writes the Contents of a YAML Node to a File.
      *
@@ -0,0 +1,119 @@
+﻿// Copyright (c) 2021-2026, Forschungszentrum Jülich GmbH. All rights reserved.
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Function.h"
+#include "YamlKey.h"
+#include "YamlNode.h"
+
+
+/**
+ * A Path to Values deep inside a Document, which is compiled once and can then be evaluated against many Nodes.
+ *
+ * Each Step is looked up directly in the Tree, without creating a FYamlNode for it:
+ *
+ *     static const FYamlPath BossHp(TEXT("levels[3].spawns.boss.hp"));
+ *     const int32 Hp = BossHp.Resolve(Root).As<int32>();
+ *
+ * A Path is a Sequence of Steps:
+ * - key or .key           The Value of a Key. Like an FString Key, it matches regardless of the Case of ASCII Letters
+ * - ["key"] or ['key']    A Key that contains Dots, Brackets or Spaces
+ * - [3]                   An Element of a Sequence, counted from the End if negative, or the Value of an Integer Key
+ * - * or [*]              All Elements of a Sequence, or all Values of a Map
+ * - [?key]                The Elements or Values that are Maps with the given Key
+ * - [?key=text]           ... whose Key holds the given Scalar, compared as Text
+ * - [?key!=text]          ... whose Key holds any other Value
+ *
+ * Paths with Wildcards or Filters can match any Number of Nodes, see FindAll() and ForEachMatch().
+ */
+struct UNREALYAML_API FYamlPath {
+    /** Compiles the Path. An invalid Path matches nothing, see IsValid() and GetError()
+     *
+     * @param bCacheMatches Remembers the Matches of the last Node the Path was evaluated against, until any Document
+     * is modified. The Cache holds on to that Node, and is locked during each Evaluation.
+     */
+    explicit FYamlPath(const FString& InPath, bool bCacheMatches = false);
+
+    FYamlPath(const FYamlPath& Other);
+    FYamlPath(FYamlPath&& Other);
+    FYamlPath& operator=(const FYamlPath& Other);
+    FYamlPath& operator=(FYamlPath&& Other);
+    ~FYamlPath();
+
+    /** If the Path was compiled successfully */
+    bool IsValid() const {
+        return Error.IsEmpty();
+    }
+
+    /** Describes why the Path could not be compiled, empty if it is valid */
+    const FString& GetError() const {
+        return Error;
+    }
+
+    /** The Text the Path was compiled from */
+    const FString& ToString() const {
+        return Path;
+    }
+
+    /** Returns the first Node the Path leads to from Root, or an empty Reference if there is none.
+     *
+     * The Reference is only valid as long as Root, and until the Document is modified */
+    FYamlNodeRef Resolve(const FYamlNode& Root) const;
+
+    /** Returns the first Node the Path leads to from Root, if there is one */
+    TOptional<FYamlNode> Find(const FYamlNode& Root) const;
+
+    /** Returns all Nodes the Path leads to from Root, in Document Order */
+    TArray<FYamlNode> FindAll(const FYamlNode& Root) const;
+
+    /** Calls Callback for all Nodes the Path leads to from Root, in Document Order. It must not evaluate this Path */
+    void ForEachMatch(const FYamlNode& Root, TFunctionRef<void(FYamlNodeRef)> Callback) const;
+
+    /** Forgets the cached Matches, and releases the Node they were found in */
+    void ResetCache() const;
+
+private:
+    enum class EStepType : uint8 {
+        Key,
+        Index,
+        Wildcard,
+        Filter,
+    };
+
+    enum class EFilterType : uint8 {
+        Exists,
+        Equals,
+        NotEquals,
+    };
+
+    struct FStep {
+        EStepType Type = EStepType::Key;
+        EFilterType Filter = EFilterType::Exists;
+        int32 Index = 0;
+        /** The Key of a Key Step or a Filter */
+        TOptional<FYamlKey> Key;
+        /** The UTF-8 encoded Text a Filter compares with */
+        std::string Text;
+    };
+
+    struct FCache;
+
+    bool Compile();
+
+    /** Calls Callback for each Node the Steps from Step on lead to, until it returns false
+     *
+     * @return false if the Callback stopped the Evaluation */
+    bool Visit(const YAML::detail::node* Node, int32 Step, const YAML::detail::shared_memory_holder& Memory,
+               TFunctionRef<bool(const YAML::detail::node&)> Callback) const;
+
+    /** Visits the Matches in Root like Visit(), from the Cache if there is one */
+    void Evaluate(const FYamlNode& Root, TFunctionRef<bool(const YAML::detail::node&)> Callback) const;
+
+    FString Path;
+    FString Error;
+    TArray<FStep> Steps;
+    TUniquePtr<FCache> Cache;
+};
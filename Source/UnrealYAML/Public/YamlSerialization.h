@@ -472,33 +472,32 @@ private:
     static bool EnsureNodeType(const FYamlNode& Node, const EYamlNodeType Expected, const bool Strict,
                                FYamlSerializationResult& Result);
 
-    // Prints error and returns false if the Node is not a scalar or cannot be converted to the given type
+    // Converts the Node into Out, which is only done once. Returns false if the Node is not a scalar or cannot be
+    // converted to the given type, which is an error in Strict mode
     template<typename ValueType>
-    static bool EnsureScalarOfType(const FYamlNode& Node, const FString& TypeName, const bool Strict,
-                                   FYamlSerializationResult& Result) {
+    static bool ConvertScalar(const FYamlNode& Node, ValueType& Out, const FString& TypeName, const bool Strict,
+                              FYamlSerializationResult& Result) {
         if (!EnsureNodeType(Node, EYamlNodeType::Scalar, Strict, Result)) {
             return false;
         }
 
-        if (Strict && Node.IsDefined() && !Node.CanConvertTo<ValueType>()) {
-            Result.AddError(TEXT("Cannot convert \"%s\" to a %s"), *Node.Scalar(), *TypeName);
-            return false;
+        if (Node.TryAs(Out)) {
+            return true;
         }
 
-        return true;
+        if (Strict && Node.IsDefined()) {
+            Result.AddError(TEXT("Cannot convert \"%s\" to a %s"), *Node.Scalar(), *TypeName);
+        }
+        return false;
     }
 
     // Deserializes the Node it into the property if it can be converted correctly
     template<typename ValueType, typename PropertyType>
     static void DeserializeScalarValue(const FYamlNode& Node, const PropertyType* Property, void* PropertyValue,
                                        const FString& TypeName, const bool Strict, FYamlSerializationResult& Result) {
-        if (!EnsureScalarOfType<ValueType>(Node, TypeName, Strict, Result)) {
-            return;
-        }
-
-        const auto Value = Node.AsOptional<ValueType>();
-        if (Value.IsSet()) {
-            Property->SetPropertyValue(PropertyValue, *Value);
+        ValueType Value;
+        if (ConvertScalar(Node, Value, TypeName, Strict, Result)) {
+            Property->SetPropertyValue(PropertyValue, Value);
         }
     }
 
@@ -0,0 +1,18 @@
+﻿// Copyright (c) 2021-2026, Forschungszentrum Jülich GmbH. All rights reserved.
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "Stats/Stats.h"
+
+
+/** Totals of all YAML Documents, shown by "stat UnrealYAML" and updated once per Frame */
+DECLARE_STATS_GROUP(TEXT("UnrealYAML"), STATGROUP_UnrealYAML, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Nodes"), STAT_YamlLiveNodes, STATGROUP_UnrealYAML, UNREALYAML_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Node Memory"), STAT_YamlNodeMemory, STATGROUP_UnrealYAML, UNREALYAML_API);
+
+/** Allocations made while Parsing or copying Nodes, see LLM_SCOPE_BYTAG(UnrealYAML) */
+LLM_DECLARE_TAG_API(UnrealYAML, UNREALYAML_API);
@@ -8,12 +8,16 @@
 #endif
 
 #include <array>
+#include <charconv>
 #include <cmath>
 #include <limits>
 #include <list>
+#include <locale>
 #include <map>
 #include <sstream>
+#include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "binary.h"
@@ -33,16 +37,16 @@ struct convert;
 
 namespace YAML {
 namespace conversion {
-inline bool IsInfinity(const std::string& input) {
+inline bool IsInfinity(std::string_view input) {
   return input == ".inf" || input == ".Inf" || input == ".INF" ||
          input == "+.inf" || input == "+.Inf" || input == "+.INF";
 }
 
-inline bool IsNegativeInfinity(const std::string& input) {
+inline bool IsNegativeInfinity(std::string_view input) {
   return input == "-.inf" || input == "-.Inf" || input == "-.INF";
 }
 
-inline bool IsNaN(const std::string& input) {
+inline bool IsNaN(std::string_view input) {
   return input == ".nan" || input == ".NaN" || input == ".NAN";
 }
 }
@@ -82,6 +86,12 @@ struct convert<char*> {
   static Node encode(const char* rhs) { return Node(rhs); }
 };
 
+// Views can only be encoded, too
+template <>
+struct convert<std::string_view> {
+  static Node encode(std::string_view rhs) { return Node(std::string(rhs)); }
+};
+
 template <std::size_t N>
 struct convert<char[N]> {
   static Node encode(const char* rhs) { return Node(rhs); }
@@ -97,125 +107,253 @@ struct convert<_Null> {
 };
 
 namespace conversion {
+inline bool IsSpace(char ch) {
+  return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\v' || ch == '\f' ||
+         ch == '\r';
+}
+
+inline bool IsDigit(char ch) { return ch >= '0' && ch <= '9'; }
+
+// Whitespace after a number is ignored, in front of it it is not
+inline const char* TrimEnd(const char* first, const char* last) {
+  while (last != first && IsSpace(last[-1]))
+    --last;
+  return last;
+}
+
+// Integers with an optional sign, written in decimal, in hexadecimal after 0x,
+// or in octal after a leading 0. Unsigned types reject any minus sign, even
+// the one of -0.
 template <typename T>
-typename std::enable_if< std::is_floating_point<T>::value, void>::type
-inner_encode(const T& rhs, std::stringstream& stream){
-  if (std::isnan(rhs)) {
-    stream << ".nan";
-  } else if (std::isinf(rhs)) {
-    if (std::signbit(rhs)) {
-      stream << "-.inf";
+bool ParseInteger(std::string_view input, T& rhs) {
+  const char* first = input.data();
+  const char* last = TrimEnd(first, first + input.size());
+
+  bool negative = false;
+  if (first != last && (*first == '-' || *first == '+')) {
+    negative = *first == '-';
+    ++first;
+  }
+  if (negative && std::is_unsigned<T>::value)
+    return false;
+
+  int base = 10;
+  if (last - first > 1 && first[0] == '0') {
+    if (first[1] == 'x' || first[1] == 'X') {
+      base = 16;
+      first += 2;
     } else {
-      stream << ".inf";
+      base = 8;
+      ++first;
     }
+  }
+
+  // the digits are read as unsigned, so a second sign is rejected as well
+  unsigned long long magnitude = 0;
+  const std::from_chars_result result =
+      std::from_chars(first, last, magnitude, base);
+  if (result.ec != std::errc() || result.ptr != last)
+    return false;
+
+  const unsigned long long max =
+      static_cast<unsigned long long>((std::numeric_limits<T>::max)());
+  if (negative) {
+    // the minimum is one further from zero than the maximum
+    if (magnitude > max + 1)
+      return false;
+    rhs = magnitude == 0
+              ? T(0)
+              : static_cast<T>(-static_cast<long long>(magnitude - 1) - 1);
   } else {
-    stream << rhs;
+    if (magnitude > max)
+      return false;
+    rhs = static_cast<T>(magnitude);
+  }
+  return true;
+}
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define YAML_CPP_FLOAT_CHARCONV 1
+#else
+// some standard libraries only convert integers with from_chars/to_chars
+#define YAML_CPP_FLOAT_CHARCONV 0
+#endif
+
+#if YAML_CPP_FLOAT_CHARCONV
+// Whether a number that from_chars found out of range is too close to zero,
+// rather than too large. Those are read as zero.
+inline bool IsUnderflow(const char* first, const char* last) {
+  // the power of ten of the first significant digit, plus one
+  long long magnitude = 0;
+  bool significant = false;
+  bool fraction = false;
+  for (; first != last && *first != 'e' && *first != 'E'; ++first) {
+    if (*first == '.') {
+      fraction = true;
+    } else if (significant || *first != '0') {
+      significant = true;
+      if (!fraction)
+        ++magnitude;
+    } else if (fraction) {
+      --magnitude;
+    }
   }
+  if (first == last)
+    return magnitude <= 0;
+
+  ++first;
+  if (first != last && *first == '+')
+    ++first;
+  long long exponent = 0;
+  if (std::from_chars(first, last, exponent).ec != std::errc())
+    return *first == '-';
+  return magnitude + exponent <= 0;
 }
+#endif
 
+// Decimal numbers with an optional sign, fraction and exponent
 template <typename T>
-typename std::enable_if<!std::is_floating_point<T>::value, void>::type
-inner_encode(const T& rhs, std::stringstream& stream){
-  stream << rhs;
+bool ParseFloat(std::string_view input, T& rhs) {
+  const char* first = input.data();
+  const char* last = TrimEnd(first, first + input.size());
+
+  bool negative = false;
+  if (first != last && (*first == '-' || *first == '+')) {
+    negative = *first == '-';
+    ++first;
+  }
+  // from_chars would also read inf, nan and hexadecimal digits
+  if (first == last || !(IsDigit(*first) || *first == '.'))
+    return false;
+
+  T value;
+#if YAML_CPP_FLOAT_CHARCONV
+  const std::from_chars_result result = std::from_chars(first, last, value);
+  if (result.ptr != last)
+    return false;
+  if (result.ec == std::errc::result_out_of_range) {
+    if (!IsUnderflow(first, last))
+      return false;
+    value = T(0);
+  } else if (result.ec != std::errc()) {
+    return false;
+  }
+#else
+  std::istringstream stream(std::string(first, last));
+  stream.imbue(std::locale::classic());
+  if (!(stream >> std::noskipws >> value) || !stream.eof())
+    return false;
+#endif
+  rhs = negative ? -value : value;
+  return true;
+}
+
+// char is a single character, the other integers are numbers
+inline std::string FormatNumber(char rhs) { return std::string(1, rhs); }
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, std::string>::type
+FormatNumber(T rhs) {
+  char buffer[24];
+  const std::to_chars_result result =
+      std::to_chars(buffer, buffer + sizeof(buffer), rhs);
+  return std::string(buffer, result.ptr);
 }
 
+// The shortest text that reads back as the same value
 template <typename T>
-typename std::enable_if<(std::is_same<T, unsigned char>::value ||
-                         std::is_same<T, signed char>::value), bool>::type
-ConvertStreamTo(std::stringstream& stream, T& rhs) {
-  int num;
-  if ((stream >> std::noskipws >> num) && (stream >> std::ws).eof()) {
-    if (num >= (std::numeric_limits<T>::min)() &&
-        num <= (std::numeric_limits<T>::max)()) {
-      rhs = (T)num;
-      return true;
-    }
+typename std::enable_if<std::is_floating_point<T>::value, std::string>::type
+FormatNumber(T rhs) {
+  if (std::isnan(rhs))
+    return ".nan";
+  if (std::isinf(rhs))
+    return std::signbit(rhs) ? "-.inf" : ".inf";
+
+#if YAML_CPP_FLOAT_CHARCONV
+  char buffer[64];
+  const std::to_chars_result result =
+      std::to_chars(buffer, buffer + sizeof(buffer), rhs);
+  return std::string(buffer, result.ptr);
+#else
+  std::ostringstream stream;
+  stream.imbue(std::locale::classic());
+  stream.precision(std::numeric_limits<T>::max_digits10);
+  stream << rhs;
+  return stream.str();
+#endif
+}
+
+inline bool ParseNumber(std::string_view input, char& rhs) {
+  if (input.empty())
+    return false;
+  for (std::size_t i = 1; i < input.size(); i++) {
+    if (!IsSpace(input[i]))
+      return false;
   }
-  return false;
+  rhs = input.front();
+  return true;
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, bool>::type ParseNumber(
+    std::string_view input, T& rhs) {
+  return ParseInteger(input, rhs);
 }
 
 template <typename T>
-typename std::enable_if<!(std::is_same<T, unsigned char>::value ||
-                          std::is_same<T, signed char>::value), bool>::type
-ConvertStreamTo(std::stringstream& stream, T& rhs) {
-  if ((stream >> std::noskipws >> rhs) && (stream >> std::ws).eof()) {
+typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+ParseNumber(std::string_view input, T& rhs) {
+  if (ParseFloat(input, rhs))
+    return true;
+
+  if (IsInfinity(input)) {
+    rhs = std::numeric_limits<T>::infinity();
+    return true;
+  } else if (IsNegativeInfinity(input)) {
+    rhs = -std::numeric_limits<T>::infinity();
+    return true;
+  } else if (IsNaN(input)) {
+    rhs = std::numeric_limits<T>::quiet_NaN();
     return true;
   }
   return false;
 }
 }
 
-#define YAML_DEFINE_CONVERT_STREAMABLE(type, negative_op)                  \
-  template <>                                                              \
-  struct convert<type> {                                                   \
-                                                                           \
-    static Node encode(const type& rhs) {                                  \
-      std::stringstream stream;                                            \
-      stream.precision(std::numeric_limits<type>::max_digits10);           \
-      conversion::inner_encode(rhs, stream);                               \
-      return Node(stream.str());                                           \
-    }                                                                      \
-                                                                           \
-    static bool decode(const Node& node, type& rhs) {                      \
-      if (node.Type() != NodeType::Scalar) {                               \
-        return false;                                                      \
-      }                                                                    \
-      const std::string& input = node.Scalar();                            \
-      std::stringstream stream(input);                                     \
-      stream.unsetf(std::ios::dec);                                        \
-      if ((stream.peek() == '-') && std::is_unsigned<type>::value) {       \
-        return false;                                                      \
-      }                                                                    \
-      if (conversion::ConvertStreamTo(stream, rhs)) {                      \
-        return true;                                                       \
-      }                                                                    \
-      if (std::numeric_limits<type>::has_infinity) {                       \
-        if (conversion::IsInfinity(input)) {                               \
-          rhs = std::numeric_limits<type>::infinity();                     \
-          return true;                                                     \
-        } else if (conversion::IsNegativeInfinity(input)) {                \
-          rhs = negative_op std::numeric_limits<type>::infinity();         \
-          return true;                                                     \
-        }                                                                  \
-      }                                                                    \
-                                                                           \
-      if (std::numeric_limits<type>::has_quiet_NaN) {                      \
-        if (conversion::IsNaN(input)) {                                    \
-          rhs = std::numeric_limits<type>::quiet_NaN();                    \
-          return true;                                                     \
-        }                                                                  \
-      }                                                                    \
-                                                                           \
-      return false;                                                        \
-    }                                                                      \
+#define YAML_DEFINE_CONVERT_NUMBER(type)                    \
+  template <>                                               \
+  struct convert<type> {                                    \
+    static Node encode(const type& rhs) {                   \
+      return Node(conversion::FormatNumber(rhs));           \
+    }                                                       \
+                                                            \
+    static bool decode(const Node& node, type& rhs) {       \
+      if (node.Type() != NodeType::Scalar) {                \
+        return false;                                       \
+      }                                                     \
+      return conversion::ParseNumber(node.Scalar(), rhs);   \
+    }                                                       \
   }
 
-#define YAML_DEFINE_CONVERT_STREAMABLE_SIGNED(type) \
-  YAML_DEFINE_CONVERT_STREAMABLE(type, -)
-
-#define YAML_DEFINE_CONVERT_STREAMABLE_UNSIGNED(type) \
-  YAML_DEFINE_CONVERT_STREAMABLE(type, +)
-
-YAML_DEFINE_CONVERT_STREAMABLE_SIGNED(int);
-YAML_DEFINE_CONVERT_STREAMABLE_SIGNED(short);
-YAML_DEFINE_CONVERT_STREAMABLE_SIGNED(long);
-YAML_DEFINE_CONVERT_STREAMABLE_SIGNED(long long);
-YAML_DEFINE_CONVERT_STREAMABLE_UNSIGNED(unsigned);
-YAML_DEFINE_CONVERT_STREAMABLE_UNSIGNED(unsigned short);
-YAML_DEFINE_CONVERT_STREAMABLE_UNSIGNED(unsigned long);
-YAML_DEFINE_CONVERT_STREAMABLE_UNSIGNED(unsigned long long);
+YAML_DEFINE_CONVERT_NUMBER(int);
+YAML_DEFINE_CONVERT_NUMBER(short);
+YAML_DEFINE_CONVERT_NUMBER(long);
+YAML_DEFINE_CONVERT_NUMBER(long long);
+YAML_DEFINE_CONVERT_NUMBER(unsigned);
+YAML_DEFINE_CONVERT_NUMBER(unsigned short);
+YAML_DEFINE_CONVERT_NUMBER(unsigned long);
+YAML_DEFINE_CONVERT_NUMBER(unsigned long long);
 
-YAML_DEFINE_CONVERT_STREAMABLE_SIGNED(char);
-YAML_DEFINE_CONVERT_STREAMABLE_SIGNED(signed char);
-YAML_DEFINE_CONVERT_STREAMABLE_UNSIGNED(unsigned char);
+YAML_DEFINE_CONVERT_NUMBER(char);
+YAML_DEFINE_CONVERT_NUMBER(signed char);
+YAML_DEFINE_CONVERT_NUMBER(unsigned char);
 
-YAML_DEFINE_CONVERT_STREAMABLE_SIGNED(float);
-YAML_DEFINE_CONVERT_STREAMABLE_SIGNED(double);
-YAML_DEFINE_CONVERT_STREAMABLE_SIGNED(long double);
+YAML_DEFINE_CONVERT_NUMBER(float);
+YAML_DEFINE_CONVERT_NUMBER(double);
+YAML_DEFINE_CONVERT_NUMBER(long double);
 
-#undef YAML_DEFINE_CONVERT_STREAMABLE_SIGNED
-#undef YAML_DEFINE_CONVERT_STREAMABLE_UNSIGNED
-#undef YAML_DEFINE_CONVERT_STREAMABLE
+#undef YAML_DEFINE_CONVERT_NUMBER
+#undef YAML_CPP_FLOAT_CHARCONV
 
 // bool
 template <>
@@ -240,13 +378,13 @@ struct convert<std::map<K, V, C, A>> {
       return false;
 
     rhs.clear();
-    for (const auto& element : node)
-#if defined(__GNUC__) && __GNUC__ < 4
-      // workaround for GCC 3:
-      rhs[element.first.template as<K>()] = element.second.template as<V>();
-#else
-      rhs[element.first.as<K>()] = element.second.as<V>();
-#endif
+    for (const auto& element : node) {
+      K key;
+      V value;
+      if (!element.first.try_as(key) || !element.second.try_as(value))
+        return false;
+      rhs[std::move(key)] = std::move(value);
+    }
     return true;
   }
 };
@@ -266,13 +404,12 @@ struct convert<std::vector<T, A>> {
       return false;
 
     rhs.clear();
-    for (const auto& element : node)
-#if defined(__GNUC__) && __GNUC__ < 4
-      // workaround for GCC 3:
-      rhs.push_back(element.template as<T>());
-#else
-      rhs.push_back(element.as<T>());
-#endif
+    for (const auto& element : node) {
+      T value;
+      if (!element.try_as(value))
+        return false;
+      rhs.push_back(std::move(value));
+    }
     return true;
   }
 };
@@ -292,13 +429,12 @@ struct convert<std::list<T,A>> {
       return false;
 
     rhs.clear();
-    for (const auto& element : node)
-#if defined(__GNUC__) && __GNUC__ < 4
-      // workaround for GCC 3:
-      rhs.push_back(element.template as<T>());
-#else
-      rhs.push_back(element.as<T>());
-#endif
+    for (const auto& element : node) {
+      T value;
+      if (!element.try_as(value))
+        return false;
+      rhs.push_back(std::move(value));
+    }
     return true;
   }
 };
@@ -320,12 +456,8 @@ struct convert<std::array<T, N>> {
     }
 
     for (auto i = 0u; i < node.size(); ++i) {
-#if defined(__GNUC__) && __GNUC__ < 4
-      // workaround for GCC 3:
-      rhs[i] = node[i].template as<T>();
-#else
-      rhs[i] = node[i].as<T>();
-#endif
+      if (!node[i].try_as(rhs[i]))
+        return false;
     }
     return true;
   }
@@ -352,19 +484,7 @@ struct convert<std::pair<T, U>> {
     if (node.size() != 2)
       return false;
 
-#if defined(__GNUC__) && __GNUC__ < 4
-    // workaround for GCC 3:
-    rhs.first = node[0].template as<T>();
-#else
-    rhs.first = node[0].as<T>();
-#endif
-#if defined(__GNUC__) && __GNUC__ < 4
-    // workaround for GCC 3:
-    rhs.second = node[1].template as<U>();
-#else
-    rhs.second = node[1].as<U>();
-#endif
-    return true;
+    return node[0].try_as(rhs.first) && node[1].try_as(rhs.second);
   }
 };
 
@@ -11,6 +11,8 @@
 #include "node/detail/node_data.h"
 
 #include <algorithm>
+#include <cassert>
+#include <string_view>
 #include <type_traits>
 
 namespace YAML {
@@ -18,7 +20,8 @@ namespace detail {
 template <typename Key, typename Enable = void>
 struct get_idx {
   static node* get(const std::vector<node*>& /* sequence */,
-                   const Key& /* key */, shared_memory_holder /* pMemory */) {
+                   const Key& /* key */,
+                   const shared_memory_holder& /* pMemory */) {
     return nullptr;
   }
 };
@@ -28,7 +31,7 @@ struct get_idx<Key,
                typename std::enable_if<std::is_unsigned<Key>::value &&
                                        !std::is_same<Key, bool>::value>::type> {
   static node* get(const std::vector<node*>& sequence, const Key& key,
-                   shared_memory_holder /* pMemory */) {
+                   const shared_memory_holder& /* pMemory */) {
     return key < sequence.size() ? sequence[key] : nullptr;
   }
 
@@ -45,7 +48,7 @@ struct get_idx<Key,
 template <typename Key>
 struct get_idx<Key, typename std::enable_if<std::is_signed<Key>::value>::type> {
   static node* get(const std::vector<node*>& sequence, const Key& key,
-                   shared_memory_holder pMemory) {
+                   const shared_memory_holder& pMemory) {
     return key >= 0 ? get_idx<std::size_t>::get(
                           sequence, static_cast<std::size_t>(key), pMemory)
                     : nullptr;
@@ -58,6 +61,13 @@ struct get_idx<Key, typename std::enable_if<std::is_signed<Key>::value>::type> {
   }
 };
 
+// Keys that get_idx looks up in a sequence
+template <typename Key>
+struct is_idx
+    : std::integral_constant<bool, (std::is_unsigned<Key>::value &&
+                                    !std::is_same<Key, bool>::value) ||
+                                       std::is_signed<Key>::value> {};
+
 template <typename Key, typename Enable = void>
 struct remove_idx {
   static bool remove(std::vector<node*>&, const Key&, std::size_t&) {
@@ -96,6 +106,52 @@ struct remove_idx<Key,
   }
 };
 
+// Keys that match a scalar with the same content. They are compared to the
+// UTF-8 bytes of the stored keys in place, instead of decoding every stored
+// key, and can be looked up through the key index of large maps.
+//
+// get() returns the key as something convertible to std::string_view, or as a
+// hashed_key_text. With ignore_case, ASCII letters match regardless of case.
+template <typename Key, typename Enable = void>
+struct key_text {
+  static constexpr bool value = false;
+};
+
+template <>
+struct key_text<std::string> {
+  static constexpr bool value = true;
+  static constexpr bool ignore_case = false;
+  static std::string_view get(const std::string& key) { return key; }
+};
+
+template <>
+struct key_text<std::string_view> {
+  static constexpr bool value = true;
+  static constexpr bool ignore_case = false;
+  static std::string_view get(std::string_view key) { return key; }
+};
+
+template <>
+struct key_text<const char*> {
+  static constexpr bool value = true;
+  static constexpr bool ignore_case = false;
+  static std::string_view get(const char* key) { return key; }
+};
+
+template <>
+struct key_text<char*> {
+  static constexpr bool value = true;
+  static constexpr bool ignore_case = false;
+  static std::string_view get(const char* key) { return key; }
+};
+
+template <std::size_t N>
+struct key_text<char[N]> {
+  static constexpr bool value = true;
+  static constexpr bool ignore_case = false;
+  static std::string_view get(const char* key) { return key; }
+};
+
 template <typename T>
 inline bool node::equals(const T& rhs, shared_memory_holder pMemory) {
   T lhs;
@@ -113,10 +169,24 @@ inline bool node::equals(const char* rhs, shared_memory_holder pMemory) {
   return false;
 }
 
+template <typename Key>
+inline node_data::node_map::const_iterator node_data::find_map_key(
+    const Key& key, const shared_memory_holder& pMemory) const {
+  if constexpr (key_text<Key>::value) {
+    const auto& text = key_text<Key>::get(key);
+    return find_text_key(text, key_text<Key>::ignore_case, pMemory);
+  } else {
+    const node_map& pairs = map().pairs;
+    return std::find_if(pairs.begin(), pairs.end(), [&](const kv_pair m) {
+      return m.first->equals(key, pMemory);
+    });
+  }
+}
+
 // indexing
 template <typename Key>
 inline node* node_data::get(const Key& key,
-                            shared_memory_holder pMemory) const {
+                            const shared_memory_holder& pMemory) const {
   switch (m_type) {
     case NodeType::Map:
       break;
@@ -124,18 +194,14 @@ inline node* node_data::get(const Key& key,
     case NodeType::Null:
       return nullptr;
     case NodeType::Sequence:
-      if (node* pNode = get_idx<Key>::get(m_sequence, key, pMemory))
-        return pNode;
-      return nullptr;
+      return get_idx<Key>::get(sequence().nodes, key, pMemory);
     case NodeType::Scalar:
       throw BadSubscript(m_mark, key);
   }
 
-  auto it = std::find_if(m_map.begin(), m_map.end(), [&](const kv_pair m) {
-    return m.first->equals(key, pMemory);
-  });
+  auto it = find_map_key(key, pMemory);
 
-  return it != m_map.end() ? it->second : nullptr;
+  return it != map().pairs.end() ? it->second : nullptr;
 }
 
 template <typename Key>
@@ -146,9 +212,14 @@ inline node& node_data::get(const Key& key, shared_memory_holder pMemory) {
     case NodeType::Undefined:
     case NodeType::Null:
     case NodeType::Sequence:
-      if (node* pNode = get_idx<Key>::get(m_sequence, key, pMemory)) {
-        m_type = NodeType::Sequence;
-        return *pNode;
+      // converted to a map below, if the key is no index. Other keys do not
+      // build a sequence first, which most of them would only throw away.
+      if constexpr (is_idx<Key>::value) {
+        if (node* pNode =
+                get_idx<Key>::get(make_sequence().nodes, key, pMemory)) {
+          m_type = NodeType::Sequence;
+          return *pNode;
+        }
       }
 
       convert_to_map(pMemory);
@@ -157,42 +228,36 @@ inline node& node_data::get(const Key& key, shared_memory_holder pMemory) {
       throw BadSubscript(m_mark, key);
   }
 
-  auto it = std::find_if(m_map.begin(), m_map.end(), [&](const kv_pair m) {
-    return m.first->equals(key, pMemory);
-  });
+  auto it = find_map_key(key, pMemory);
 
-  if (it != m_map.end()) {
+  if (it != map().pairs.end()) {
     return *it->second;
   }
 
+  assert(!m_isFrozen);
   node& k = convert_to_node(key, pMemory);
   node& v = pMemory->create_node();
-  insert_map_pair(k, v);
+  insert_map_pair(k, v, pMemory);
   return v;
 }
 
 template <typename Key>
 inline bool node_data::remove(const Key& key, shared_memory_holder pMemory) {
+  assert(!m_isFrozen);
+
   if (m_type == NodeType::Sequence) {
-    return remove_idx<Key>::remove(m_sequence, key, m_seqSize);
+    sequence_data& data = sequence();
+    return remove_idx<Key>::remove(data.nodes, key, data.size);
   }
 
   if (m_type == NodeType::Map) {
-    kv_pairs::iterator it = m_undefinedPairs.begin();
-    while (it != m_undefinedPairs.end()) {
-      kv_pairs::iterator jt = std::next(it);
-      if (it->first->equals(key, pMemory)) {
-        m_undefinedPairs.erase(it);
-      }
-      it = jt;
-    }
+    auto iter = find_map_key(key, pMemory);
 
-    auto iter = std::find_if(m_map.begin(), m_map.end(), [&](const kv_pair m) {
-      return m.first->equals(key, pMemory);
-    });
-
-    if (iter != m_map.end()) {
-      m_map.erase(iter);
+    map_data& data = map();
+    if (iter != data.pairs.end()) {
+      data.undefinedPairs.remove(*iter);
+      data.pairs.erase(iter);
+      reset_key_index();
       return true;
     }
   }
@@ -204,6 +269,8 @@ inline bool node_data::remove(const Key& key, shared_memory_holder pMemory) {
 template <typename Key, typename Value>
 inline void node_data::force_insert(const Key& key, const Value& value,
                                     shared_memory_holder pMemory) {
+  assert(!m_isFrozen);
+
   switch (m_type) {
     case NodeType::Map:
       break;
@@ -218,7 +285,7 @@ inline void node_data::force_insert(const Key& key, const Value& value,
 
   node& k = convert_to_node(key, pMemory);
   node& v = convert_to_node(value, pMemory);
-  insert_map_pair(k, v);
+  insert_map_pair(k, v, pMemory);
 }
 
 template <typename T>
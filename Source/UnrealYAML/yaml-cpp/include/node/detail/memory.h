@@ -7,38 +7,113 @@
 #pragma once
 #endif
 
-#include <set>
-
+#include <cstddef>
+#include <list>
+#include <vector>
 
 #include "node/ptr.h"
 
 namespace YAML {
+struct MemoryStats;
 namespace detail {
 class node;
+class node_pool;
+struct key_revision;
 }  // namespace detail
 }  // namespace YAML
 
 namespace YAML {
 namespace detail {
+/**
+ * Owns the nodes of a document.
+ *
+ * By default, each node (and its ref and data) is a separate heap allocation.
+ * In arena mode, they are carved out of large blocks instead, which are freed
+ * together once the last node in them is gone.
+ *
+ * The nodes are kept in pools. Merging moves all pools of the other memory
+ * into this one in constant time, no matter how many nodes they hold.
+ *
+ * The memory of a frozen document (see Freeze()) is never merged, since other
+ * threads may read it at the same time. Memories that refer to its nodes keep
+ * it alive instead.
+ */
 class YAML_CPP_API memory {
  public:
-  memory() : m_nodes{} {}
+  memory();
+  explicit memory(bool useArena);
+  memory(const memory&) = delete;
+  memory& operator=(const memory&) = delete;
+  ~memory();
+
   node& create_node();
-  void merge(const memory& rhs);
+  void merge(memory& rhs);
+  void keep(const shared_memory& pFrozen);
+
+  // the number of nodes in our pools
+  std::size_t size() const;
+
+  // Counts the changes to the keys of the indexed maps in our pools, see
+  // node_data::mark_indexed_key()
+  key_revision& get_key_revision();
+
+  void freeze() { m_isFrozen = true; }
+  bool is_frozen() const { return m_isFrozen; }
+
+  // see memory_holder::revision()
+  std::size_t revision() const { return m_revision; }
+  void mark_modified() { m_revision++; }
+
+  // frozen memories that are kept are counted with their own documents
+  void add_stats(MemoryStats& stats) const;
 
  private:
-  using Nodes = std::set<shared_node>;
-  Nodes m_nodes;
+  friend class memory_holder;
+
+  // the first pool is our own, where new nodes are created
+  using Pools = std::list<node_pool>;
+  Pools m_pools;
+
+  // The first is our own. The ones of merged memories are kept, since the keys
+  // in their pools may still point to them.
+  std::list<key_revision> m_keyRevisions;
+
+  // Set once our pools were merged into another memory. Holders that still
+  // refer to us keep that memory alive through this, and move on to it the
+  // next time they are used.
+  shared_memory m_pForward;
+
+  // frozen memories whose nodes are referred to from our pools
+  std::vector<shared_memory> m_kept;
+  std::size_t m_revision;
+  bool m_isFrozen;
 };
 
 class YAML_CPP_API memory_holder {
  public:
   memory_holder() : m_pMemory(new memory) {}
+  explicit memory_holder(bool useArena) : m_pMemory(new memory(useArena)) {}
 
-  node& create_node() { return m_pMemory->create_node(); }
+  node& create_node() { return current()->create_node(); }
   void merge(memory_holder& rhs);
+  std::size_t size() { return current()->size(); }
+  key_revision& get_key_revision() {
+    return current()->get_key_revision();
+  }
+  void freeze() { current()->freeze(); }
+
+  // Counts the modifications of the document through Node, so that results
+  // computed from it, like resolved paths, can be reused until the next one.
+  // Building a new document is not counted. A merge counts for both memories,
+  // so holders that move on to the merged memory see a new revision too.
+  std::size_t revision() { return current()->revision(); }
+  void mark_modified() { current()->mark_modified(); }
+
+  void add_stats(MemoryStats& stats) { current()->add_stats(stats); }
 
  private:
+  const shared_memory& current();
+
   shared_memory m_pMemory;
 };
 }  // namespace detail
@@ -12,6 +12,8 @@
 #include "node/detail/node_ref.h"
 #include "node/ptr.h"
 #include "node/type.h"
+#include <cassert>
+#include <memory>
 #include <set>
 #include <atomic>
 
@@ -24,7 +26,9 @@ class node {
   };
 
  public:
-  node() : m_pRef(new node_ref), m_dependencies{}, m_index{} {}
+  node() : m_pRef(new node_ref), m_pDependencies{}, m_index{} {}
+  explicit node(shared_node_ref pRef)
+      : m_pRef(std::move(pRef)), m_pDependencies{}, m_index{} {}
   node(const node&) = delete;
   node& operator=(const node&) = delete;
 
@@ -39,6 +43,13 @@ class node {
   const std::string& tag() const { return m_pRef->tag(); }
   EmitterStyle style() const { return m_pRef->style(); }
 
+  void mark_indexed_key(key_revision* pRevision) const {
+    m_pRef->mark_indexed_key(pRevision);
+  }
+
+  void freeze() { m_pRef->freeze(); }
+  bool is_frozen() const { return m_pRef->is_frozen(); }
+
   template <typename T>
   bool equals(const T& rhs, shared_memory_holder pMemory);
   bool equals(const char* rhs, shared_memory_holder pMemory);
@@ -48,21 +59,28 @@ class node {
       return;
 
     m_pRef->mark_defined();
-    for (node* dependency : m_dependencies)
-      dependency->mark_defined();
-    m_dependencies.clear();
+    if (m_pDependencies) {
+      for (node* dependency : *m_pDependencies)
+        dependency->mark_defined();
+      m_pDependencies.reset();
+    }
   }
 
   void add_dependency(node& rhs) {
-    if (is_defined())
+    if (is_defined()) {
       rhs.mark_defined();
-    else
-      m_dependencies.insert(&rhs);
+    } else {
+      if (!m_pDependencies)
+        m_pDependencies.reset(new nodes);
+      m_pDependencies->insert(&rhs);
+    }
   }
 
   void set_ref(const node& rhs) {
+    assert(!is_frozen());
     if (rhs.is_defined())
       mark_defined();
+    m_pRef->invalidate_key_indexes();
     m_pRef = rhs.m_pRef;
   }
   void set_data(const node& rhs) {
@@ -110,6 +128,8 @@ class node {
   }
   node_iterator end() { return m_pRef->end(); }
 
+  void reserve(std::size_t size) { m_pRef->reserve(size); }
+
   // sequence
   void push_back(node& input, shared_memory_holder pMemory) {
     m_pRef->push_back(input, pMemory);
@@ -124,7 +144,7 @@ class node {
 
   // indexing
   template <typename Key>
-  node* get(const Key& key, shared_memory_holder pMemory) const {
+  node* get(const Key& key, const shared_memory_holder& pMemory) const {
     // NOTE: this returns a non-const node so that the top-level Node can wrap
     // it, and returns a pointer so that it can be nullptr (if there is no such
     // key).
@@ -141,7 +161,7 @@ class node {
     return m_pRef->remove(key, pMemory);
   }
 
-  node* get(node& key, shared_memory_holder pMemory) const {
+  node* get(node& key, const shared_memory_holder& pMemory) const {
     // NOTE: this returns a non-const node so that the top-level Node can wrap
     // it, and returns a pointer so that it can be nullptr (if there is no such
     // key).
@@ -166,8 +186,9 @@ class node {
 
  private:
   shared_node_ref m_pRef;
+  // only undefined nodes have dependencies, so the set is created on demand
   using nodes = std::set<node*, less>;
-  nodes m_dependencies;
+  std::unique_ptr<nodes> m_pDependencies;
   size_t m_index;
   static YAML_CPP_API std::atomic<size_t> m_amount;
 };
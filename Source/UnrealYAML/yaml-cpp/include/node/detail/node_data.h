@@ -7,10 +7,14 @@
 #pragma once
 #endif
 
+#include <atomic>
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <variant>
 #include <vector>
 
 
@@ -27,11 +31,24 @@ class node;
 
 namespace YAML {
 namespace detail {
+// Counts the changes to the keys of the indexed maps of one memory, see
+// memory::get_key_revision()
+struct key_revision {
+  std::size_t value = 0;
+};
+
+// A map key with its node_data::hash_key() computed in advance
+struct hashed_key_text {
+  std::string_view text;
+  std::size_t hash;
+};
+
 class YAML_CPP_API node_data {
  public:
   node_data();
   node_data(const node_data&) = delete;
   node_data& operator=(const node_data&) = delete;
+  ~node_data();
 
   void mark_defined();
   void set_mark(const Mark& mark);
@@ -46,10 +63,35 @@ class YAML_CPP_API node_data {
   NodeType type() const {
     return m_isDefined ? m_type : NodeType::Undefined;
   }
-  const std::string& scalar() const { return m_scalar; }
-  const std::string& tag() const { return m_tag; }
+  const std::string& scalar() const {
+    const std::string* pScalar = std::get_if<std::string>(&m_payload);
+    return pScalar ? *pScalar : empty_scalar();
+  }
+  const std::string& tag() const { return *m_pTag; }
   EmitterStyle style() const { return m_style; }
 
+  // Keys of indexed maps point to the key revision of the memory of the map,
+  // so that only the indexes of that memory are invalidated when one of them
+  // changes
+  void mark_indexed_key(key_revision* pRevision) const {
+    m_pKeyRevision = pRevision;
+  }
+  void invalidate_key_indexes() const {
+    if (m_pKeyRevision)
+      m_pKeyRevision->value++;
+  }
+
+  // Frozen data, and all nodes reachable from it, can no longer be modified.
+  // Everything that is computed lazily is computed in advance, so reading it
+  // does not write to anything and is safe from any thread.
+  void freeze();
+  bool is_frozen() const { return m_isFrozen; }
+
+  // heap memory held by the text of a scalar and an uncommon tag, and by the
+  // members of a collection including its key index, see GetMemoryStats()
+  std::size_t scalar_capacity() const;
+  std::size_t container_capacity() const;
+
   // size/iterator
   std::size_t size() const;
 
@@ -59,13 +101,16 @@ class YAML_CPP_API node_data {
   const_node_iterator end() const;
   node_iterator end();
 
+  // room for the members of a sequence or a map, which does not change its size
+  void reserve(std::size_t size);
+
   // sequence
   void push_back(node& node, const shared_memory_holder& pMemory);
   void insert(node& key, node& value, const shared_memory_holder& pMemory);
 
   // indexing
   template <typename Key>
-  node* get(const Key& key, shared_memory_holder pMemory) const;
+  node* get(const Key& key, const shared_memory_holder& pMemory) const;
   template <typename Key>
   node& get(const Key& key, shared_memory_holder pMemory);
   template <typename Key>
@@ -83,14 +128,79 @@ class YAML_CPP_API node_data {
  public:
   static const std::string& empty_scalar();
 
+  // the hash of a key in the key index, which ignores the case of ASCII letters
+  static std::size_t hash_key(std::string_view key);
+
  private:
   void compute_seq_size() const;
   void compute_map_size() const;
 
   void reset_sequence();
   void reset_map();
+  void release_tag();
+
+  void insert_map_pair(node& key, node& value,
+                       const shared_memory_holder& pMemory);
+
+  using node_seq = std::vector<node*>;
+  using node_map = std::vector<std::pair<node*, node*>>;
+  using kv_pair = std::pair<node*, node*>;
+  using kv_pairs = std::list<kv_pair>;
+
+  struct sequence_data {
+    node_seq nodes;
+    // the number of leading defined nodes
+    mutable std::size_t size = 0;
+  };
+
+  struct key_index;
+  struct map_data {
+    map_data();
+    ~map_data();
+
+    node_map pairs;
+    mutable kv_pairs undefinedPairs;
+
+    // scalar key -> position in pairs, built on the first lookup in a large map
+    mutable std::unique_ptr<key_index> pIndex;
+  };
+
+  // only valid while m_type is the corresponding type
+  const sequence_data& sequence() const {
+    return *std::get<std::unique_ptr<sequence_data>>(m_payload);
+  }
+  sequence_data& sequence() {
+    return *std::get<std::unique_ptr<sequence_data>>(m_payload);
+  }
+  const map_data& map() const {
+    return *std::get<std::unique_ptr<map_data>>(m_payload);
+  }
+  map_data& map() { return *std::get<std::unique_ptr<map_data>>(m_payload); }
+  // the sequence, which is created while the node is not one yet
+  sequence_data& make_sequence();
+
+  template <typename Key>
+  node_map::const_iterator find_map_key(
+      const Key& key, const shared_memory_holder& pMemory) const;
+  node_map::const_iterator find_text_key(
+      std::string_view key, bool ignoreCase,
+      const shared_memory_holder& pMemory) const {
+    return find_text_key(key, nullptr, ignoreCase, pMemory);
+  }
+  node_map::const_iterator find_text_key(
+      const hashed_key_text& key, bool ignoreCase,
+      const shared_memory_holder& pMemory) const {
+    return find_text_key(key.text, &key.hash, ignoreCase, pMemory);
+  }
+  node_map::const_iterator find_text_key(
+      std::string_view key, const std::size_t* pHash, bool ignoreCase,
+      const shared_memory_holder& pMemory) const;
+  // the index of the keys of a map, which is valid until pRevision changes,
+  // or forever if it is nullptr
+  void build_key_index(key_revision* pRevision) const;
+  bool has_current_key_index(const key_revision& revision) const;
+  void reset_key_index();
 
-  void insert_map_pair(node& key, node& value);
   void convert_to_map(const shared_memory_holder& pMemory);
   void convert_sequence_to_map(const shared_memory_holder& pMemory);
 
@@ -98,28 +208,28 @@ class YAML_CPP_API node_data {
   static node& convert_to_node(const T& rhs, shared_memory_holder pMemory);
 
  private:
-  bool m_isDefined;
+  // ordered by size, so that they are packed together
   Mark m_mark;
   NodeType m_type;
-  std::string m_tag;
   EmitterStyle m_style;
+  bool m_isDefined;
+  bool m_isFrozen;
+  bool m_ownsTag;
 
-  // scalar
-  std::string m_scalar;
+  // shared for common tags, otherwise owned, see set_tag()
+  const std::string* m_pTag;
 
-  // sequence
-  using node_seq = std::vector<node *>;
-  node_seq m_sequence;
+  // see mark_indexed_key(), owned by the memory
+  mutable key_revision* m_pKeyRevision;
 
-  mutable std::size_t m_seqSize;
+  // What m_type holds: the text of a scalar, or the members of a sequence or a
+  // map. Collections are allocated separately, so that scalars, which most
+  // nodes are, do not pay for their members.
+  using payload = std::variant<std::monostate, std::string,
+                               std::unique_ptr<sequence_data>,
+                               std::unique_ptr<map_data>>;
+  payload m_payload;
 
-  // map
-  using node_map = std::vector<std::pair<node*, node*>>;
-  node_map m_map;
-
-  using kv_pair = std::pair<node*, node*>;
-  using kv_pairs = std::list<kv_pair>;
-  mutable kv_pairs m_undefinedPairs;
 };
 }
 }
@@ -12,11 +12,14 @@
 #include "node/ptr.h"
 #include "node/detail/node_data.h"
 
+#include <cassert>
+
 namespace YAML {
 namespace detail {
 class node_ref {
  public:
   node_ref() : m_pData(new node_data) {}
+  explicit node_ref(shared_node_data pData) : m_pData(std::move(pData)) {}
   node_ref(const node_ref&) = delete;
   node_ref& operator=(const node_ref&) = delete;
 
@@ -28,7 +31,21 @@ class node_ref {
   EmitterStyle style() const { return m_pData->style(); }
 
   void mark_defined() { m_pData->mark_defined(); }
-  void set_data(const node_ref& rhs) { m_pData = rhs.m_pData; }
+  void set_data(const node_ref& rhs) {
+    assert(!is_frozen());
+    m_pData->invalidate_key_indexes();
+    m_pData = rhs.m_pData;
+  }
+
+  void mark_indexed_key(key_revision* pRevision) const {
+    m_pData->mark_indexed_key(pRevision);
+  }
+  void invalidate_key_indexes() const { m_pData->invalidate_key_indexes(); }
+
+  void freeze() { m_pData->freeze(); }
+  bool is_frozen() const { return m_pData->is_frozen(); }
+
+  const node_data& data() const { return *m_pData; }
 
   void set_mark(const Mark& mark) { m_pData->set_mark(mark); }
   void set_type(NodeType type) { m_pData->set_type(type); }
@@ -50,6 +67,8 @@ class node_ref {
   }
   node_iterator end() { return m_pData->end(); }
 
+  void reserve(std::size_t size) { m_pData->reserve(size); }
+
   // sequence
   void push_back(node& node, shared_memory_holder pMemory) {
     m_pData->push_back(node, pMemory);
@@ -60,7 +79,7 @@ class node_ref {
 
   // indexing
   template <typename Key>
-  node* get(const Key& key, shared_memory_holder pMemory) const {
+  node* get(const Key& key, const shared_memory_holder& pMemory) const {
     return static_cast<const node_data&>(*m_pData).get(key, pMemory);
   }
   template <typename Key>
@@ -72,7 +91,7 @@ class node_ref {
     return m_pData->remove(key, pMemory);
   }
 
-  node* get(node& key, shared_memory_holder pMemory) const {
+  node* get(node& key, const shared_memory_holder& pMemory) const {
     return static_cast<const node_data&>(*m_pData).get(key, pMemory);
   }
   node& get(node& key, shared_memory_holder pMemory) {
@@ -72,6 +72,10 @@ inline bool Node::IsDefined() const {
   return m_pNode ? m_pNode->is_defined() : true;
 }
 
+inline bool Node::IsFrozen() const {
+  return m_pNode && m_pNode->is_frozen();
+}
+
 inline Mark Node::Mark() const {
   if (!m_isValid) {
     throw InvalidNode(m_invalidKey);
@@ -163,6 +167,36 @@ inline T Node::as(const S& fallback) const {
   return as_if<T, S>(*this)(fallback);
 }
 
+template <typename T>
+inline bool Node::try_as(T& rhs) const {
+  if (!m_isValid || !m_pNode)
+    return false;
+
+  T t;
+  if (!convert<T>::decode(*this, t))
+    return false;
+  rhs = std::move(t);
+  return true;
+}
+
+// as<std::string>() reads null as "null"
+template <>
+inline bool Node::try_as<std::string>(std::string& rhs) const {
+  if (!m_isValid)
+    return false;
+
+  switch (Type()) {
+    case NodeType::Null:
+      rhs = "null";
+      return true;
+    case NodeType::Scalar:
+      rhs = Scalar();
+      return true;
+    default:
+      return false;
+  }
+}
+
 inline const std::string& Node::Scalar() const {
   if (!m_isValid)
     throw InvalidNode(m_invalidKey);
@@ -230,16 +264,19 @@ inline void Node::Assign(const T& rhs) {
 template <>
 inline void Node::Assign(const std::string& rhs) {
   EnsureNodeExists();
+  m_pMemory->mark_modified();
   m_pNode->set_scalar(rhs);
 }
 
 inline void Node::Assign(const char* rhs) {
   EnsureNodeExists();
+  m_pMemory->mark_modified();
   m_pNode->set_scalar(rhs);
 }
 
 inline void Node::Assign(char* rhs) {
   EnsureNodeExists();
+  m_pMemory->mark_modified();
   m_pNode->set_scalar(rhs);
 }
 
@@ -247,6 +284,7 @@ inline void Node::AssignData(const Node& rhs) {
   EnsureNodeExists();
   rhs.EnsureNodeExists();
 
+  m_pMemory->mark_modified();
   m_pNode->set_data(*rhs.m_pNode);
   m_pMemory->merge(*rhs.m_pMemory);
 }
@@ -262,6 +300,7 @@ inline void Node::AssignNode(const Node& rhs) {
     return;
   }
 
+  m_pMemory->mark_modified();
   m_pNode->set_ref(*rhs.m_pNode);
   m_pMemory->merge(*rhs.m_pMemory);
   m_pNode = rhs.m_pNode;
@@ -311,6 +350,7 @@ inline void Node::push_back(const Node& rhs) {
   EnsureNodeExists();
   rhs.EnsureNodeExists();
 
+  m_pMemory->mark_modified();
   m_pNode->push_back(*rhs.m_pNode, m_pMemory);
   m_pMemory->merge(*rhs.m_pMemory);
 }
@@ -335,6 +375,9 @@ inline const Node Node::operator[](const Key& key) const {
 template <typename Key>
 inline Node Node::operator[](const Key& key) {
   EnsureNodeExists();
+  // frozen nodes can not insert missing keys
+  if (m_pNode->is_frozen())
+    return static_cast<const Node&>(*this)[key];
   detail::node& value = m_pNode->get(key, m_pMemory);
   return Node(value, m_pMemory);
 }
@@ -342,13 +385,17 @@ inline Node Node::operator[](const Key& key) {
 template <typename Key>
 inline bool Node::remove(const Key& key) {
   EnsureNodeExists();
+  m_pMemory->mark_modified();
   return m_pNode->remove(key, m_pMemory);
 }
 
 inline const Node Node::operator[](const Node& key) const {
   EnsureNodeExists();
   key.EnsureNodeExists();
-  m_pMemory->merge(*key.m_pMemory);
+  // the lookup only compares the nodes, and frozen memory is shared between
+  // threads
+  if (!m_pNode->is_frozen())
+    m_pMemory->merge(*key.m_pMemory);
   detail::node* value =
       static_cast<const detail::node&>(*m_pNode).get(*key.m_pNode, m_pMemory);
   if (!value) {
@@ -360,6 +407,8 @@ inline const Node Node::operator[](const Node& key) const {
 inline Node Node::operator[](const Node& key) {
   EnsureNodeExists();
   key.EnsureNodeExists();
+  if (m_pNode->is_frozen())
+    return static_cast<const Node&>(*this)[key];
   m_pMemory->merge(*key.m_pMemory);
   detail::node& value = m_pNode->get(*key.m_pNode, m_pMemory);
   return Node(value, m_pMemory);
@@ -368,6 +417,7 @@ inline Node Node::operator[](const Node& key) {
 inline bool Node::remove(const Node& key) {
   EnsureNodeExists();
   key.EnsureNodeExists();
+  m_pMemory->mark_modified();
   return m_pNode->remove(*key.m_pNode, m_pMemory);
 }
 
@@ -375,11 +425,34 @@ inline bool Node::remove(const Node& key) {
 template <typename Key, typename Value>
 inline void Node::force_insert(const Key& key, const Value& value) {
   EnsureNodeExists();
+  m_pMemory->mark_modified();
   m_pNode->force_insert(key, value, m_pMemory);
 }
 
 // free functions
 inline bool operator==(const Node& lhs, const Node& rhs) { return lhs.is(rhs); }
+
+namespace detail {
+// For views that walk the nodes of a document without copying a Node for each
+// of them. A node stays alive as long as the memory of the Node it was reached
+// from, and is only valid until the document is modified.
+struct node_access {
+  // nullptr for an invalid or empty Node
+  static const node* get(const Node& rhs) {
+    return rhs.m_isValid ? rhs.m_pNode : nullptr;
+  }
+
+  // a Node for one of the nodes reached from owner, sharing its memory
+  static Node make(const Node& owner, const node& rhs) {
+    return Node(const_cast<node&>(rhs), owner.m_pMemory);
+  }
+
+  // for the const lookups of node, e.g. node::get()
+  static const shared_memory_holder& memory(const Node& owner) {
+    return owner.m_pMemory;
+  }
+};
+}  // namespace detail
 }  // namespace YAML
 
 #endif  // NODE_IMPL_H_62B23520_7C8E_11DE_8A39_0800200C9A66
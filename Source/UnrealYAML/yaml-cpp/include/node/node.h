@@ -18,10 +18,12 @@
 #include "node/type.h"
 
 namespace YAML {
+struct MemoryStats;
 namespace detail {
 class node;
 class node_data;
 struct iterator_value;
+struct node_access;
 }  // namespace detail
 }  // namespace YAML
 
@@ -31,12 +33,17 @@ class YAML_CPP_API Node {
   friend class NodeBuilder;
   friend class NodeEvents;
   friend struct detail::iterator_value;
+  friend struct detail::node_access;
   friend class detail::node;
   friend class detail::node_data;
   template <typename>
   friend class detail::iterator_base;
   template <typename T, typename S>
   friend struct as_if;
+  friend YAML_CPP_API Node Clone(const Node& node);
+  friend YAML_CPP_API Node CloneUnshared(const Node& node);
+  friend YAML_CPP_API Node Freeze(const Node& node);
+  friend YAML_CPP_API MemoryStats GetMemoryStats(const Node& node);
 
   using iterator = YAML::iterator;
   using const_iterator = YAML::const_iterator;
@@ -57,6 +64,9 @@ class YAML_CPP_API Node {
   bool IsSequence() const { return Type() == NodeType::Sequence; }
   bool IsMap() const { return Type() == NodeType::Map; }
 
+  // see Freeze()
+  bool IsFrozen() const;
+
   // bool conversions
   explicit operator bool() const { return IsDefined(); }
   bool operator!() const { return !IsDefined(); }
@@ -66,6 +76,11 @@ class YAML_CPP_API Node {
   T as() const;
   template <typename T, typename S>
   T as(const S& fallback) const;
+  // Converts like as<T>(), but returns false instead of throwing if the node is
+  // invalid or cannot be converted. rhs is only assigned on success. Exceptions
+  // thrown by convert<T>::decode itself are passed on.
+  template <typename T>
+  bool try_as(T& rhs) const;
   const std::string& Scalar() const;
 
   const std::string& Tag() const;
@@ -139,8 +154,43 @@ class YAML_CPP_API Node {
 
 YAML_CPP_API bool operator==(const Node& lhs, const Node& rhs);
 
+// Returns a deep copy. A node that appears in several places, like an anchored
+// node and its aliases, is copied once and shared by all of them, as it is in
+// the original.
 YAML_CPP_API Node Clone(const Node& node);
 
+// Like Clone(), but each place gets a copy of its own, which saves keeping
+// track of all copies. Recursive structures are still copied as such. Nested
+// aliases would multiply the size of the copy with every level, so once it
+// grows far beyond the memory of the source, this returns Clone(node) instead.
+YAML_CPP_API Node CloneUnshared(const Node& node);
+
+// Returns a deep copy that can no longer be modified. It can be read from any
+// number of threads at once, as long as every thread uses its own Node
+// objects, and assigned into other documents, which only reference it.
+// Modifying it, e.g. by assigning to one of its nodes, asserts.
+YAML_CPP_API Node Freeze(const Node& node);
+
+// The memory of the document a node belongs to. Documents that were assigned
+// into each other share their memory, so this is not limited to the subtree of
+// the node.
+struct MemoryStats {
+  // including keys, and nodes that are no longer reachable
+  std::size_t nodes = 0;
+  // the text of all scalars
+  std::size_t scalarBytes = 0;
+  // the members of sequences and maps, including the key indexes of maps
+  std::size_t containerBytes = 0;
+  // all of the above, plus the nodes themselves
+  std::size_t allocatedBytes = 0;
+};
+
+YAML_CPP_API MemoryStats GetMemoryStats(const Node& node);
+
+// The nodes and allocatedBytes of all memories that are alive, in every
+// thread. It is cheap to call, and lags behind by a few nodes per thread.
+YAML_CPP_API MemoryStats GetTotalMemoryStats();
+
 template <typename T>
 struct convert;
 }
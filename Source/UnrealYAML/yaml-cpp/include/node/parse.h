@@ -7,11 +7,13 @@
 #pragma once
 #endif
 
+#include <cstddef>
+#include <functional>
 #include <iosfwd>
 #include <string>
 #include <vector>
 
-
+#include "mark.h"
 
 namespace YAML {
 class Node;
@@ -30,6 +32,14 @@ YAML_CPP_API Node Load(const std::string& input);
  */
 YAML_CPP_API Node Load(const char* input);
 
+/**
+ * Loads the input buffer as a single YAML document. The buffer is read in
+ * place and does not need to be null-terminated.
+ *
+ * @throws {@link ParserException} if it is malformed.
+ */
+YAML_CPP_API Node Load(const char* input, std::size_t size);
+
 /**
  * Loads the input stream as a single YAML document.
  *
@@ -59,6 +69,57 @@ YAML_CPP_API std::vector<Node> LoadAll(const std::string& input);
  */
 YAML_CPP_API std::vector<Node> LoadAll(const char* input);
 
+/**
+ * Loads the input buffer as a list of YAML documents. The buffer is read in
+ * place and does not need to be null-terminated.
+ *
+ * @throws {@link ParserException} if it is malformed.
+ */
+YAML_CPP_API std::vector<Node> LoadAll(const char* input, std::size_t size);
+
+/**
+ * Loads the input buffer as a list of YAML documents, when it is a part of a
+ * larger input that starts at {@code origin}. The buffer must start at the
+ * beginning of a line. The marks of the nodes are given as positions inside
+ * the larger input.
+ *
+ * @throws {@link ParserException} if it is malformed, with the mark of the
+ * error inside the larger input.
+ */
+YAML_CPP_API std::vector<Node> LoadAll(const char* input, std::size_t size,
+                                       const Mark& origin);
+
+/** The kinds of lines that matter for finding the boundaries of documents. */
+enum class LineKind { Blank, Directive, DocumentStart, DocumentEnd, Content };
+
+/**
+ * Classifies a line (without its line break) by a quick look at its start. A
+ * "---" or "..." at the start of a line always is a document marker, even
+ * inside a scalar, and comments count as blank lines.
+ */
+YAML_CPP_API LineKind ClassifyLine(const char* line, std::size_t length);
+
+/**
+ * Runs {@code body(i)} for every i in [0, count), in any order and possibly
+ * concurrently. Must not return before all calls have finished.
+ */
+using ParallelFor = std::function<void(
+    std::size_t count, const std::function<void(std::size_t)>& body)>;
+
+/**
+ * Loads the input buffer as a list of YAML documents, parsing the documents
+ * independently of each other through {@code parallelFor}. The documents are
+ * found by a quick scan for "---" and "..." lines first, so the result is the
+ * same as for the sequential overload. Input that cannot be split safely (not
+ * UTF-8, or using directives, which carry over to later documents) is loaded
+ * sequentially.
+ *
+ * @throws {@link ParserException} if it is malformed; the first error in the
+ * input is reported.
+ */
+YAML_CPP_API std::vector<Node> LoadAll(const char* input, std::size_t size,
+                                       const ParallelFor& parallelFor);
+
 /**
  * Loads the input stream as a list of YAML documents.
  *
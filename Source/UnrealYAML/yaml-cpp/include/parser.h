@@ -7,6 +7,7 @@
 #pragma once
 #endif
 
+#include <cstddef>
 #include <ios>
 #include <memory>
 
@@ -37,6 +38,12 @@ class YAML_CPP_API Parser {
    */
   explicit Parser(std::istream& in);
 
+  /**
+   * Constructs a parser reading directly from the given buffer, without any
+   * intermediate stream. The buffer must live as long as the parser.
+   */
+  Parser(const char* input, std::size_t size);
+
   ~Parser();
 
   /** Evaluates to true if the parser has some valid input to be read. */
@@ -48,6 +55,11 @@ class YAML_CPP_API Parser {
    */
   void Load(std::istream& in);
 
+  /**
+   * Resets the parser with the given buffer. Any existing state is erased.
+   */
+  void Load(const char* input, std::size_t size);
+
   /**
    * Handles the next document by calling events on the {@code eventHandler}.
    *
@@ -19,9 +19,183 @@ namespace YAML {
 // file.
 
 namespace Exp {
+////////////////////////////////////////////////////////////////////////////////
+// Character classes and hand-written matchers for the expressions the scanner
+// checks on (nearly) every character. Each matcher returns exactly what the
+// corresponding RegEx would return for a Stream, without walking the tree.
+
+namespace CharClass {
+enum : unsigned char {
+  Blank = 1 << 0,          // ' ' '\t'
+  Break = 1 << 1,          // '\n' '\r' (the latter only when followed by '\n')
+  FlowIndicator = 1 << 2,  // , [ ] { }
+  Indicator = 1 << 3,      // # & * ! | > ' " % @ `
+  FlowEnd = 1 << 4,        // , ] }
+};
+
+struct Table {
+  unsigned char flags[256];
+};
+
+constexpr Table MakeTable() {
+  Table table{};
+  table.flags[static_cast<unsigned char>(' ')] |= Blank;
+  table.flags[static_cast<unsigned char>('\t')] |= Blank;
+  table.flags[static_cast<unsigned char>('\n')] |= Break;
+  table.flags[static_cast<unsigned char>('\r')] |= Break;
+  for (const char* ch = ",[]{}"; *ch; ++ch)
+    table.flags[static_cast<unsigned char>(*ch)] |= FlowIndicator;
+  for (const char* ch = "#&*!|>\'\"%@`"; *ch; ++ch)
+    table.flags[static_cast<unsigned char>(*ch)] |= Indicator;
+  for (const char* ch = ",]}"; *ch; ++ch)
+    table.flags[static_cast<unsigned char>(*ch)] |= FlowEnd;
+  return table;
+}
+
+inline bool Is(char ch, unsigned char classes) {
+  static constexpr Table table = MakeTable();
+  return (table.flags[static_cast<unsigned char>(ch)] & classes) != 0;
+}
+}  // namespace CharClass
+
+inline int MatchEmpty(const Stream& in) {
+  return in.peek() == Stream::eof() ? 0 : -1;
+}
+inline int MatchBlank(const Stream& in) {
+  return CharClass::Is(in.peek(), CharClass::Blank) ? 1 : -1;
+}
+inline int MatchBreakAt(const Stream& in, std::size_t i) {
+  const char ch = in.peek(i);
+  if (ch == '\n')
+    return 1;
+  if (ch == '\r' && in.peek(i + 1) == '\n')
+    return 2;
+  return -1;
+}
+inline int MatchBreak(const Stream& in) { return MatchBreakAt(in, 0); }
+inline int MatchBlankOrBreakAt(const Stream& in, std::size_t i) {
+  const char ch = in.peek(i);
+  if (!CharClass::Is(ch, CharClass::Blank | CharClass::Break))
+    return -1;
+  return CharClass::Is(ch, CharClass::Blank) ? 1 : MatchBreakAt(in, i);
+}
+inline int MatchBlankOrBreak(const Stream& in) {
+  return MatchBlankOrBreakAt(in, 0);
+}
+// (BlankOrBreak | Empty) at position i
+inline int MatchBlankOrBreakOrEmptyAt(const Stream& in, std::size_t i) {
+  const int n = MatchBlankOrBreakAt(in, i);
+  if (n >= 0)
+    return n;
+  return in.peek(i) == Stream::eof() ? 0 : -1;
+}
+// 'indicator' followed by (BlankOrBreak | Empty)
+inline int MatchIndicatorAt(const Stream& in, char indicator,
+                            std::size_t count) {
+  for (std::size_t i = 0; i < count; i++) {
+    if (in.peek(i) != indicator)
+      return -1;
+  }
+  const int n = MatchBlankOrBreakOrEmptyAt(in, count);
+  return n >= 0 ? static_cast<int>(count) + n : -1;
+}
+inline int MatchDocStart(const Stream& in) {
+  return MatchIndicatorAt(in, '-', 3);
+}
+inline int MatchDocEnd(const Stream& in) {
+  return MatchIndicatorAt(in, '.', 3);
+}
+inline int MatchDocIndicator(const Stream& in) {
+  const int n = MatchDocStart(in);
+  return n >= 0 ? n : MatchDocEnd(in);
+}
+inline int MatchBlockEntry(const Stream& in) {
+  return MatchIndicatorAt(in, '-', 1);
+}
+inline int MatchKey(const Stream& in) {
+  if (in.peek() != '?')
+    return -1;
+  const int n = MatchBlankOrBreakAt(in, 1);
+  return n >= 0 ? 1 + n : -1;
+}
+inline int MatchValue(const Stream& in) {
+  return MatchIndicatorAt(in, ':', 1);
+}
+inline int MatchValueInFlow(const Stream& in) {
+  if (in.peek() != ':')
+    return -1;
+  const int n = MatchBlankOrBreakAt(in, 1);
+  if (n >= 0)
+    return 1 + n;
+  return CharClass::Is(in.peek(1), CharClass::FlowEnd) ? 2 : -1;
+}
+inline int MatchValueInJSONFlow(const Stream& in) {
+  return in.peek() == ':' ? 1 : -1;
+}
+inline int MatchComment(const Stream& in) {
+  return in.peek() == '#' ? 1 : -1;
+}
+inline int MatchPlainScalar(const Stream& in) {
+  const char ch = in.peek();
+  if (CharClass::Is(ch, CharClass::FlowIndicator | CharClass::Indicator))
+    return -1;
+  if (MatchBlankOrBreak(in) >= 0)
+    return -1;
+  if ((ch == '-' || ch == '?' || ch == ':') &&
+      MatchBlankOrBreakOrEmptyAt(in, 1) >= 0)
+    return -1;
+  return 1;
+}
+inline int MatchPlainScalarInFlow(const Stream& in) {
+  const char ch = in.peek();
+  if (ch == '?' ||
+      CharClass::Is(ch, CharClass::FlowIndicator | CharClass::Indicator))
+    return -1;
+  if (MatchBlankOrBreak(in) >= 0)
+    return -1;
+  if ((ch == '-' || ch == ':') &&
+      (CharClass::Is(in.peek(1), CharClass::Blank) ||
+       in.peek(1) == Stream::eof()))
+    return -1;
+  return 1;
+}
+inline int MatchEndScalar(const Stream& in) { return MatchValue(in); }
+inline int MatchEndScalarInFlow(const Stream& in) {
+  const char ch = in.peek();
+  if (ch == ':') {
+    const int n = MatchBlankOrBreakOrEmptyAt(in, 1);
+    if (n >= 0)
+      return 1 + n;
+    if (CharClass::Is(in.peek(1), CharClass::FlowEnd))
+      return 2;
+  }
+  return (ch == '?' || CharClass::Is(ch, CharClass::FlowIndicator)) ? 1 : -1;
+}
+// BlankOrBreak + Comment
+inline int MatchBlankOrBreakThenComment(const Stream& in) {
+  const int n = MatchBlankOrBreak(in);
+  if (n < 0 || in.peek(static_cast<std::size_t>(n)) != '#')
+    return -1;
+  return n + 1;
+}
+inline int MatchScanScalarEnd(const Stream& in) {
+  const int n = MatchEndScalar(in);
+  return n >= 0 ? n : MatchBlankOrBreakThenComment(in);
+}
+inline int MatchScanScalarEndInFlow(const Stream& in) {
+  const int n = MatchEndScalarInFlow(in);
+  return n >= 0 ? n : MatchBlankOrBreakThenComment(in);
+}
+inline int MatchEscBreak(const Stream& in) {
+  if (in.peek() != '\\')
+    return -1;
+  const int n = MatchBreakAt(in, 1);
+  return n >= 0 ? 1 + n : -1;
+}
+
 // misc
 inline const RegEx& Empty() {
-  static const RegEx e;
+  static const RegEx e(RegEx(), &MatchEmpty);
   return e;
 }
 inline const RegEx& Space() {
@@ -33,15 +207,15 @@ inline const RegEx& Tab() {
   return e;
 }
 inline const RegEx& Blank() {
-  static const RegEx e = Space() | Tab();
+  static const RegEx e(Space() | Tab(), &MatchBlank);
   return e;
 }
 inline const RegEx& Break() {
-  static const RegEx e = RegEx('\n') | RegEx("\r\n");
+  static const RegEx e(RegEx('\n') | RegEx("\r\n"), &MatchBreak);
   return e;
 }
 inline const RegEx& BlankOrBreak() {
-  static const RegEx e = Blank() | Break();
+  static const RegEx e(Blank() | Break(), &MatchBlankOrBreak);
   return e;
 }
 inline const RegEx& Digit() {
@@ -82,43 +256,48 @@ inline const RegEx& Utf8_ByteOrderMark() {
 // actual tags
 
 inline const RegEx& DocStart() {
-  static const RegEx e = RegEx("---") + (BlankOrBreak() | RegEx());
+  static const RegEx e(RegEx("---") + (BlankOrBreak() | RegEx()),
+                       &MatchDocStart);
   return e;
 }
 inline const RegEx& DocEnd() {
-  static const RegEx e = RegEx("...") + (BlankOrBreak() | RegEx());
+  static const RegEx e(RegEx("...") + (BlankOrBreak() | RegEx()),
+                       &MatchDocEnd);
   return e;
 }
 inline const RegEx& DocIndicator() {
-  static const RegEx e = DocStart() | DocEnd();
+  static const RegEx e(DocStart() | DocEnd(), &MatchDocIndicator);
   return e;
 }
 inline const RegEx& BlockEntry() {
-  static const RegEx e = RegEx('-') + (BlankOrBreak() | RegEx());
+  static const RegEx e(RegEx('-') + (BlankOrBreak() | RegEx()),
+                       &MatchBlockEntry);
   return e;
 }
 inline const RegEx& Key() {
-  static const RegEx e = RegEx('?') + BlankOrBreak();
+  static const RegEx e(RegEx('?') + BlankOrBreak(), &MatchKey);
   return e;
 }
 inline const RegEx& KeyInFlow() {
-  static const RegEx e = RegEx('?') + BlankOrBreak();
+  static const RegEx e(RegEx('?') + BlankOrBreak(), &MatchKey);
   return e;
 }
 inline const RegEx& Value() {
-  static const RegEx e = RegEx(':') + (BlankOrBreak() | RegEx());
+  static const RegEx e(RegEx(':') + (BlankOrBreak() | RegEx()), &MatchValue);
   return e;
 }
 inline const RegEx& ValueInFlow() {
-  static const RegEx e = RegEx(':') + (BlankOrBreak() | RegEx(",]}", REGEX_OR));
+  static const RegEx e(
+      RegEx(':') + (BlankOrBreak() | RegEx(",]}", REGEX_OR)),
+      &MatchValueInFlow);
   return e;
 }
 inline const RegEx& ValueInJSONFlow() {
-  static const RegEx e = RegEx(':');
+  static const RegEx e(RegEx(':'), &MatchValueInJSONFlow);
   return e;
 }
-inline const RegEx Comment() {
-  static const RegEx e = RegEx('#');
+inline const RegEx& Comment() {
+  static const RegEx e(RegEx('#'), &MatchComment);
   return e;
 }
 inline const RegEx& Anchor() {
@@ -147,35 +326,41 @@ inline const RegEx& Tag() {
 // . In the flow context ? is illegal and : and - must not be followed with a
 // space.
 inline const RegEx& PlainScalar() {
-  static const RegEx e =
+  static const RegEx e(
       !(BlankOrBreak() | RegEx(",[]{}#&*!|>\'\"%@`", REGEX_OR) |
-        (RegEx("-?:", REGEX_OR) + (BlankOrBreak() | RegEx())));
+        (RegEx("-?:", REGEX_OR) + (BlankOrBreak() | RegEx()))),
+      &MatchPlainScalar);
   return e;
 }
 inline const RegEx& PlainScalarInFlow() {
-  static const RegEx e =
+  static const RegEx e(
       !(BlankOrBreak() | RegEx("?,[]{}#&*!|>\'\"%@`", REGEX_OR) |
-        (RegEx("-:", REGEX_OR) + (Blank() | RegEx())));
+        (RegEx("-:", REGEX_OR) + (Blank() | RegEx()))),
+      &MatchPlainScalarInFlow);
   return e;
 }
 inline const RegEx& EndScalar() {
-  static const RegEx e = RegEx(':') + (BlankOrBreak() | RegEx());
+  static const RegEx e(RegEx(':') + (BlankOrBreak() | RegEx()),
+                       &MatchEndScalar);
   return e;
 }
 inline const RegEx& EndScalarInFlow() {
-  static const RegEx e =
+  static const RegEx e(
       (RegEx(':') + (BlankOrBreak() | RegEx() | RegEx(",]}", REGEX_OR))) |
-      RegEx(",?[]{}", REGEX_OR);
+          RegEx(",?[]{}", REGEX_OR),
+      &MatchEndScalarInFlow);
   return e;
 }
 
 inline const RegEx& ScanScalarEndInFlow() {
-  static const RegEx e = (EndScalarInFlow() | (BlankOrBreak() + Comment()));
+  static const RegEx e(EndScalarInFlow() | (BlankOrBreak() + Comment()),
+                       &MatchScanScalarEndInFlow);
   return e;
 }
 
 inline const RegEx& ScanScalarEnd() {
-  static const RegEx e = EndScalar() | (BlankOrBreak() + Comment());
+  static const RegEx e(EndScalar() | (BlankOrBreak() + Comment()),
+                       &MatchScanScalarEnd);
   return e;
 }
 inline const RegEx& EscSingleQuote() {
@@ -183,7 +368,7 @@ inline const RegEx& EscSingleQuote() {
   return e;
 }
 inline const RegEx& EscBreak() {
-  static const RegEx e = RegEx('\\') + Break();
+  static const RegEx e(RegEx('\\') + Break(), &MatchEscBreak);
   return e;
 }
 
@@ -1,26 +1,275 @@
 #include "node/detail/memory.h"
 #include "node/detail/node.h"  // IWYU pragma: keep
+#include "node/node.h"
 #include "node/ptr.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
 namespace YAML {
 namespace detail {
+namespace {
+std::atomic<std::ptrdiff_t> totalNodes{0};
+std::atomic<std::ptrdiff_t> totalBytes{0};
+
+// Changes are collected per thread and published in batches, so threads that
+// create nodes at the same time do not contend for the totals
+struct pending_totals {
+  static constexpr std::ptrdiff_t NODE_BATCH = 64;
+  static constexpr std::ptrdiff_t BYTE_BATCH = 64 * 1024;
+
+  ~pending_totals() { publish(); }
+
+  void add(std::ptrdiff_t nodeCount, std::ptrdiff_t byteCount) {
+    nodes += nodeCount;
+    bytes += byteCount;
+    if (nodes >= NODE_BATCH || nodes <= -NODE_BATCH || bytes >= BYTE_BATCH ||
+        bytes <= -BYTE_BATCH)
+      publish();
+  }
+
+  void publish() {
+    totalNodes.fetch_add(nodes, std::memory_order_relaxed);
+    totalBytes.fetch_add(bytes, std::memory_order_relaxed);
+    nodes = 0;
+    bytes = 0;
+  }
+
+  std::ptrdiff_t nodes = 0;
+  std::ptrdiff_t bytes = 0;
+};
+
+void count_memory(std::ptrdiff_t nodes, std::ptrdiff_t bytes) {
+  thread_local pending_totals pending;
+  pending.add(nodes, bytes);
+}
+
+// A node that is not allocated from an arena is three allocations, each with
+// the control block of its shared_ptr
+constexpr std::ptrdiff_t PLAIN_NODE_SIZE =
+    sizeof(node) + sizeof(node_ref) + sizeof(node_data) + 3 * 3 * sizeof(void*);
+}  // namespace
+
+// Hands out memory from large blocks. Nothing is returned individually; the
+// blocks are freed with the arena.
+class arena {
+ public:
+  arena() : m_blocks{}, m_pos(nullptr), m_end(nullptr), m_allocated(0) {}
+  arena(const arena&) = delete;
+  arena& operator=(const arena&) = delete;
+  ~arena() { count_memory(0, -static_cast<std::ptrdiff_t>(m_allocated)); }
+
+  void* allocate(std::size_t size, std::size_t alignment) {
+    std::uintptr_t pos = reinterpret_cast<std::uintptr_t>(m_pos);
+    pos = (pos + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+
+    if (!m_pos || pos + size > reinterpret_cast<std::uintptr_t>(m_end)) {
+      // oversized requests get a block of their own, so the current one can
+      // still be used up
+      if (size > BLOCK_SIZE / 4)
+        return allocate_block(size);
+
+      m_pos = allocate_block(BLOCK_SIZE);
+      m_end = m_pos + BLOCK_SIZE;
+      pos = reinterpret_cast<std::uintptr_t>(m_pos);
+    }
+
+    m_pos = reinterpret_cast<char*>(pos + size);
+    return reinterpret_cast<void*>(pos);
+  }
+
+  std::size_t allocated() const { return m_allocated; }
+
+ private:
+  static constexpr std::size_t BLOCK_SIZE = 64 * 1024;
+
+  char* allocate_block(std::size_t size) {
+    // new[] aligns for any fundamental type
+    m_blocks.emplace_back(new char[size]);
+    m_allocated += size;
+    count_memory(0, static_cast<std::ptrdiff_t>(size));
+    return m_blocks.back().get();
+  }
+
+  std::vector<std::unique_ptr<char[]>> m_blocks;
+  char* m_pos;
+  char* m_end;
+  std::size_t m_allocated;
+};
+
+// Every object allocated through it keeps the arena alive, since a node_ref or
+// node_data may end up being shared with nodes of another memory
+template <typename T>
+class arena_allocator {
+ public:
+  using value_type = T;
+
+  explicit arena_allocator(std::shared_ptr<arena> pArena)
+      : m_pArena(std::move(pArena)) {}
+  template <typename U>
+  arena_allocator(const arena_allocator<U>& rhs) : m_pArena(rhs.m_pArena) {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(m_pArena->allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T*, std::size_t) {}
+
+  template <typename U>
+  bool operator==(const arena_allocator<U>& rhs) const {
+    return m_pArena == rhs.m_pArena;
+  }
+  template <typename U>
+  bool operator!=(const arena_allocator<U>& rhs) const {
+    return m_pArena != rhs.m_pArena;
+  }
+
+ private:
+  template <typename U>
+  friend class arena_allocator;
+
+  std::shared_ptr<arena> m_pArena;
+};
+
+class node_pool {
+ public:
+  explicit node_pool(bool useArena)
+      : m_pArena(useArena ? std::make_shared<arena>() : nullptr), m_nodes{} {}
+  node_pool(const node_pool&) = delete;
+  node_pool& operator=(const node_pool&) = delete;
+  ~node_pool() {
+    const std::ptrdiff_t nodes = static_cast<std::ptrdiff_t>(m_nodes.size());
+    count_memory(-nodes, m_pArena ? 0 : -nodes * PLAIN_NODE_SIZE);
+  }
+
+  node& create_node() {
+    if (!m_pArena) {
+      m_nodes.emplace_back(new node);
+      count_memory(1, PLAIN_NODE_SIZE);
+      return *m_nodes.back();
+    }
+
+    arena_allocator<char> allocator(m_pArena);
+    shared_node_ref pRef = std::allocate_shared<node_ref>(
+        allocator, std::allocate_shared<node_data>(allocator));
+    m_nodes.push_back(std::allocate_shared<node>(allocator, std::move(pRef)));
+    count_memory(1, 0);
+    return *m_nodes.back();
+  }
+
+  std::size_t size() const { return m_nodes.size(); }
+
+  // data shared by several nodes is only counted once
+  void add_stats(MemoryStats& stats,
+                 std::unordered_set<const node_data*>& counted) const {
+    stats.nodes += m_nodes.size();
+    stats.allocatedBytes += m_nodes.capacity() * sizeof(shared_node);
+    stats.allocatedBytes += m_pArena ? m_pArena->allocated()
+                                     : m_nodes.size() * PLAIN_NODE_SIZE;
+
+    for (const shared_node& pNode : m_nodes) {
+      const node_data& data = pNode->ref()->data();
+      if (!counted.insert(&data).second)
+        continue;
+
+      const std::size_t containerBytes = data.container_capacity();
+      stats.scalarBytes += data.scalar().size();
+      stats.containerBytes += containerBytes;
+      stats.allocatedBytes += data.scalar_capacity() + containerBytes;
+    }
+  }
+
+ private:
+  std::shared_ptr<arena> m_pArena;
+  std::vector<shared_node> m_nodes;
+};
+
+const shared_memory& memory_holder::current() {
+  while (m_pMemory->m_pForward)
+    m_pMemory = m_pMemory->m_pForward;
+  return m_pMemory;
+}
 
 void memory_holder::merge(memory_holder& rhs) {
-  if (m_pMemory == rhs.m_pMemory)
+  const shared_memory& pMemory = current();
+  // a frozen memory is never forwarded, and must not be written to
+  if (rhs.m_pMemory->is_frozen()) {
+    pMemory->keep(rhs.m_pMemory);
     return;
+  }
+
+  const shared_memory& pRhs = rhs.current();
+  if (pMemory == pRhs)
+    return;
+
+  // only memories that were never merged into another one are merged, so the
+  // forwarding never forms a cycle
+  pMemory->merge(*pRhs);
+  pRhs->m_pForward = pMemory;
+  rhs.m_pMemory = pMemory;
+}
+
+memory::memory() : memory(false) {}
+
+memory::memory(bool useArena)
+    : m_pools{},
+      m_keyRevisions(1),
+      m_pForward{},
+      m_kept{},
+      m_revision(0),
+      m_isFrozen(false) {
+  m_pools.emplace_back(useArena);
+}
+
+memory::~memory() = default;
+
+node& memory::create_node() { return m_pools.front().create_node(); }
 
-  m_pMemory->merge(*rhs.m_pMemory);
-  rhs.m_pMemory = m_pMemory;
+void memory::merge(memory& rhs) {
+  m_revision = std::max(m_revision, rhs.m_revision) + 1;
+  m_pools.splice(m_pools.end(), rhs.m_pools);
+  m_keyRevisions.splice(m_keyRevisions.end(), rhs.m_keyRevisions);
+  for (const shared_memory& pFrozen : rhs.m_kept)
+    keep(pFrozen);
+  rhs.m_kept.clear();
 }
 
-node& memory::create_node() {
-  shared_node pNode(new node);
-  m_nodes.insert(pNode);
-  return *pNode;
+void memory::keep(const shared_memory& pFrozen) {
+  if (pFrozen.get() == this ||
+      std::find(m_kept.begin(), m_kept.end(), pFrozen) != m_kept.end())
+    return;
+  m_kept.push_back(pFrozen);
+}
+
+key_revision& memory::get_key_revision() { return m_keyRevisions.front(); }
+
+std::size_t memory::size() const {
+  std::size_t size = 0;
+  for (const node_pool& pool : m_pools)
+    size += pool.size();
+  return size;
 }
 
-void memory::merge(const memory& rhs) {
-  m_nodes.insert(rhs.m_nodes.begin(), rhs.m_nodes.end());
+void memory::add_stats(MemoryStats& stats) const {
+  std::unordered_set<const node_data*> counted;
+  for (const node_pool& pool : m_pools)
+    pool.add_stats(stats, counted);
 }
 }  // namespace detail
+
+MemoryStats GetTotalMemoryStats() {
+  MemoryStats stats;
+  // the batches of different threads may be published out of order
+  const std::ptrdiff_t nodes =
+      detail::totalNodes.load(std::memory_order_relaxed);
+  const std::ptrdiff_t bytes =
+      detail::totalBytes.load(std::memory_order_relaxed);
+  stats.nodes = nodes > 0 ? static_cast<std::size_t>(nodes) : 0;
+  stats.allocatedBytes = bytes > 0 ? static_cast<std::size_t>(bytes) : 0;
+  return stats;
+}
 }  // namespace YAML
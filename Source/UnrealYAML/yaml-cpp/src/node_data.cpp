@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <sstream>
+#include <unordered_map>
 
 #include "exceptions.h"
 #include "node/detail/memory.h"
@@ -16,32 +19,116 @@ namespace YAML {
 namespace detail {
 YAML_CPP_API std::atomic<size_t> node::m_amount{0};
 
+// Smaller maps are searched linearly
+static const std::size_t KEY_INDEX_THRESHOLD = 16;
+
+struct node_data::key_index {
+  // the key revision of the memory when this was built, see build_key_index()
+  const key_revision* pRevision;
+  std::size_t revision;
+  // hash_key() of the scalar keys -> position in map_data::pairs
+  std::unordered_multimap<std::size_t, std::size_t> positions;
+};
+
+static char fold_case(char ch) {
+  return ch >= 'A' && ch <= 'Z' ? static_cast<char>(ch - 'A' + 'a') : ch;
+}
+
+// FNV-1a over the case-folded bytes, so the index serves lookups with and
+// without ignoreCase
+std::size_t node_data::hash_key(std::string_view key) {
+  std::uint64_t hash = 14695981039346656037ull;
+  for (const char ch : key) {
+    hash ^= static_cast<unsigned char>(fold_case(ch));
+    hash *= 1099511628211ull;
+  }
+  return static_cast<std::size_t>(hash);
+}
+
+static bool key_matches(const node& key, std::string_view text,
+                        bool ignoreCase) {
+  if (key.type() != NodeType::Scalar)
+    return false;
+
+  const std::string& scalar = key.scalar();
+  if (scalar.size() != text.size())
+    return false;
+  if (!ignoreCase)
+    return std::memcmp(scalar.data(), text.data(), text.size()) == 0;
+
+  for (std::size_t i = 0; i < text.size(); i++) {
+    if (fold_case(scalar[i]) != fold_case(text[i]))
+      return false;
+  }
+  return true;
+}
+
+// Almost all nodes share a handful of tags: the non-specific tags of plain and
+// quoted scalars, and the tags of the YAML schemas. These are stored once and
+// found without a lock. All other tags are owned by their node, so tags from
+// untrusted input are freed with it.
+static const std::string* find_common_tag(const std::string& tag) {
+  static const std::string commonTags[] = {
+      "?",
+      "!",
+      "tag:yaml.org,2002:str",
+      "tag:yaml.org,2002:int",
+      "tag:yaml.org,2002:float",
+      "tag:yaml.org,2002:bool",
+      "tag:yaml.org,2002:null",
+      "tag:yaml.org,2002:seq",
+      "tag:yaml.org,2002:map",
+      "tag:yaml.org,2002:binary",
+      "tag:yaml.org,2002:timestamp",
+      "tag:yaml.org,2002:merge",
+  };
+  if (tag.empty())
+    return &node_data::empty_scalar();
+  for (const std::string& common : commonTags) {
+    if (tag == common)
+      return &common;
+  }
+  return nullptr;
+}
+
 const std::string& node_data::empty_scalar() {
   static const std::string svalue;
   return svalue;
 }
 
+node_data::map_data::map_data() : pairs{}, undefinedPairs{}, pIndex{} {}
+
+node_data::map_data::~map_data() = default;
+
 node_data::node_data()
-    : m_isDefined(false),
-      m_mark(Mark::null_mark()),
+    : m_mark(Mark::null_mark()),
       m_type(NodeType::Null),
-      m_tag{},
       m_style(EmitterStyle::Default),
-      m_scalar{},
-      m_sequence{},
-      m_seqSize(0),
-      m_map{},
-      m_undefinedPairs{} {}
+      m_isDefined(false),
+      m_isFrozen(false),
+      m_ownsTag(false),
+      m_pTag(&empty_scalar()),
+      m_pKeyRevision(nullptr),
+      m_payload{} {}
+
+node_data::~node_data() { release_tag(); }
 
 void node_data::mark_defined() {
+  assert(!m_isFrozen);
   if (m_type == NodeType::Undefined)
     m_type = NodeType::Null;
   m_isDefined = true;
 }
 
-void node_data::set_mark(const Mark& mark) { m_mark = mark; }
+void node_data::set_mark(const Mark& mark) {
+  assert(!m_isFrozen);
+  m_mark = mark;
+}
 
 void node_data::set_type(NodeType type) {
+  assert(!m_isFrozen);
+  invalidate_key_indexes();
+
   if (type == NodeType::Undefined) {
     m_type = type;
     m_isDefined = false;
@@ -58,7 +145,7 @@ void node_data::set_type(NodeType type) {
     case NodeType::Null:
       break;
     case NodeType::Scalar:
-      m_scalar.clear();
+      m_payload.emplace<std::string>();
       break;
     case NodeType::Sequence:
       reset_sequence();
@@ -72,19 +159,51 @@ void node_data::set_type(NodeType type) {
   }
 }
 
-void node_data::set_tag(const std::string& tag) { m_tag = tag; }
+void node_data::set_tag(const std::string& tag) {
+  assert(!m_isFrozen);
+  release_tag();
+  if (const std::string* pCommon = find_common_tag(tag)) {
+    m_pTag = pCommon;
+    return;
+  }
+
+  m_pTag = new std::string(tag);
+  m_ownsTag = true;
+}
+
+void node_data::release_tag() {
+  if (!m_ownsTag)
+    return;
 
-void node_data::set_style(EmitterStyle style) { m_style = style; }
+  delete m_pTag;
+  m_pTag = &empty_scalar();
+  m_ownsTag = false;
+}
+
+void node_data::set_style(EmitterStyle style) {
+  assert(!m_isFrozen);
+  m_style = style;
+}
 
 void node_data::set_null() {
+  assert(!m_isFrozen);
+  invalidate_key_indexes();
+
   m_isDefined = true;
   m_type = NodeType::Null;
+  m_payload.emplace<std::monostate>();
 }
 
 void node_data::set_scalar(const std::string& scalar) {
+  assert(!m_isFrozen);
+  invalidate_key_indexes();
+
   m_isDefined = true;
   m_type = NodeType::Scalar;
-  m_scalar = scalar;
+  if (std::string* pScalar = std::get_if<std::string>(&m_payload))
+    *pScalar = scalar;
+  else
+    m_payload.emplace<std::string>(scalar);
 }
 
 // size/iterator
@@ -95,26 +214,99 @@ std::size_t node_data::size() const {
   switch (m_type) {
     case NodeType::Sequence:
       compute_seq_size();
-      return m_seqSize;
+      return sequence().size;
     case NodeType::Map:
       compute_map_size();
-      return m_map.size() - m_undefinedPairs.size();
+      return map().pairs.size() - map().undefinedPairs.size();
     default:
       return 0;
   }
 }
 
+void node_data::freeze() {
+  if (m_isFrozen)
+    return;
+
+  if (m_type == NodeType::Sequence) {
+    compute_seq_size();
+  } else if (m_type == NodeType::Map) {
+    compute_map_size();
+    if (map().pairs.size() >= KEY_INDEX_THRESHOLD)
+      build_key_index(nullptr);
+  }
+  m_isFrozen = true;
+
+  // aliased nodes are only frozen once, which also ends recursive structures
+  if (m_type == NodeType::Sequence) {
+    for (node* pNode : sequence().nodes)
+      pNode->freeze();
+  } else if (m_type == NodeType::Map) {
+    for (const kv_pair& pair : map().pairs) {
+      pair.first->freeze();
+      pair.second->freeze();
+    }
+  }
+}
+
+std::size_t node_data::scalar_capacity() const {
+  // short strings are stored inline
+  const auto heapBytes = [](const std::string& text) -> std::size_t {
+    return text.capacity() < sizeof(std::string) ? 0 : text.capacity() + 1;
+  };
+
+  std::size_t bytes = m_ownsTag ? sizeof(std::string) + heapBytes(*m_pTag) : 0;
+  if (const std::string* pScalar = std::get_if<std::string>(&m_payload))
+    bytes += heapBytes(*pScalar);
+  return bytes;
+}
+
+std::size_t node_data::container_capacity() const {
+  // the nodes of lists and hash tables are estimated as the value and two
+  // pointers
+  constexpr std::size_t LINK_SIZE = 2 * sizeof(void*);
+
+  if (const auto* pSequence =
+          std::get_if<std::unique_ptr<sequence_data>>(&m_payload)) {
+    return sizeof(sequence_data) +
+           (*pSequence)->nodes.capacity() * sizeof(node*);
+  }
+
+  const auto* pMap = std::get_if<std::unique_ptr<map_data>>(&m_payload);
+  if (!pMap)
+    return 0;
+
+  const map_data& data = **pMap;
+  std::size_t bytes =
+      sizeof(map_data) + data.pairs.capacity() * sizeof(kv_pair) +
+      data.undefinedPairs.size() * (sizeof(kv_pair) + LINK_SIZE);
+  if (data.pIndex) {
+    const auto& positions = data.pIndex->positions;
+    bytes += sizeof(key_index) + positions.bucket_count() * sizeof(void*) +
+             positions.size() *
+                 (sizeof(std::pair<std::size_t, std::size_t>) + LINK_SIZE);
+  }
+  return bytes;
+}
+
 void node_data::compute_seq_size() const {
-  while (m_seqSize < m_sequence.size() && m_sequence[m_seqSize]->is_defined())
-    m_seqSize++;
+  if (m_isFrozen)
+    return;
+
+  const sequence_data& data = sequence();
+  while (data.size < data.nodes.size() && data.nodes[data.size]->is_defined())
+    data.size++;
 }
 
 void node_data::compute_map_size() const {
-  auto it = m_undefinedPairs.begin();
-  while (it != m_undefinedPairs.end()) {
+  if (m_isFrozen)
+    return;
+
+  kv_pairs& undefinedPairs = map().undefinedPairs;
+  auto it = undefinedPairs.begin();
+  while (it != undefinedPairs.end()) {
     auto jt = std::next(it);
     if (it->first->is_defined() && it->second->is_defined())
-      m_undefinedPairs.erase(it);
+      undefinedPairs.erase(it);
     it = jt;
   }
 }
@@ -125,9 +317,9 @@ const_node_iterator node_data::begin() const {
 
   switch (m_type) {
     case NodeType::Sequence:
-      return const_node_iterator(m_sequence.begin());
+      return const_node_iterator(sequence().nodes.begin());
     case NodeType::Map:
-      return const_node_iterator(m_map.begin(), m_map.end());
+      return const_node_iterator(map().pairs.begin(), map().pairs.end());
     default:
       return {};
   }
@@ -139,9 +331,9 @@ node_iterator node_data::begin() {
 
   switch (m_type) {
     case NodeType::Sequence:
-      return node_iterator(m_sequence.begin());
+      return node_iterator(sequence().nodes.begin());
     case NodeType::Map:
-      return node_iterator(m_map.begin(), m_map.end());
+      return node_iterator(map().pairs.begin(), map().pairs.end());
     default:
       return {};
   }
@@ -153,9 +345,9 @@ const_node_iterator node_data::end() const {
 
   switch (m_type) {
     case NodeType::Sequence:
-      return const_node_iterator(m_sequence.end());
+      return const_node_iterator(sequence().nodes.end());
     case NodeType::Map:
-      return const_node_iterator(m_map.end(), m_map.end());
+      return const_node_iterator(map().pairs.end(), map().pairs.end());
     default:
       return {};
   }
@@ -167,17 +359,28 @@ node_iterator node_data::end() {
 
   switch (m_type) {
     case NodeType::Sequence:
-      return node_iterator(m_sequence.end());
+      return node_iterator(sequence().nodes.end());
     case NodeType::Map:
-      return node_iterator(m_map.end(), m_map.end());
+      return node_iterator(map().pairs.end(), map().pairs.end());
     default:
       return {};
   }
 }
 
+void node_data::reserve(std::size_t size) {
+  assert(!m_isFrozen);
+
+  if (m_type == NodeType::Sequence)
+    sequence().nodes.reserve(size);
+  else if (m_type == NodeType::Map)
+    map().pairs.reserve(size);
+}
+
 // sequence
 void node_data::push_back(node& node,
                           const shared_memory_holder& /* pMemory */) {
+  assert(!m_isFrozen);
+
   if (m_type == NodeType::Undefined || m_type == NodeType::Null) {
     m_type = NodeType::Sequence;
     reset_sequence();
@@ -186,11 +389,13 @@ void node_data::push_back(node& node,
   if (m_type != NodeType::Sequence)
     throw BadPushback();
 
-  m_sequence.push_back(&node);
+  sequence().nodes.push_back(&node);
 }
 
 void node_data::insert(node& key, node& value,
                        const shared_memory_holder& pMemory) {
+  assert(!m_isFrozen);
+
   switch (m_type) {
     case NodeType::Map:
       break;
@@ -203,7 +408,7 @@ void node_data::insert(node& key, node& value,
       throw BadSubscript(m_mark, key);
   }
 
-  insert_map_pair(key, value);
+  insert_map_pair(key, value, pMemory);
 }
 
 // indexing
@@ -213,7 +418,7 @@ node* node_data::get(node& key,
     return nullptr;
   }
 
-  for (const auto& it : m_map) {
+  for (const auto& it : map().pairs) {
     if (it.first->is(key))
       return it.second;
   }
@@ -234,56 +439,137 @@ node& node_data::get(node& key, const shared_memory_holder& pMemory) {
       throw BadSubscript(m_mark, key);
   }
 
-  for (const auto& it : m_map) {
+  for (const auto& it : map().pairs) {
     if (it.first->is(key))
       return *it.second;
   }
 
+  assert(!m_isFrozen);
   node& value = pMemory->create_node();
-  insert_map_pair(key, value);
+  insert_map_pair(key, value, pMemory);
   return value;
 }
 
 bool node_data::remove(node& key, const shared_memory_holder& /* pMemory */) {
+  assert(!m_isFrozen);
+
   if (m_type != NodeType::Map)
     return false;
 
-  for (auto it = m_undefinedPairs.begin(); it != m_undefinedPairs.end();) {
+  map_data& data = map();
+  for (auto it = data.undefinedPairs.begin();
+       it != data.undefinedPairs.end();) {
     auto jt = std::next(it);
     if (it->first->is(key))
-      m_undefinedPairs.erase(it);
+      data.undefinedPairs.erase(it);
     it = jt;
   }
 
   auto it =
-      std::find_if(m_map.begin(), m_map.end(),
+      std::find_if(data.pairs.begin(), data.pairs.end(),
                    [&](std::pair<YAML::detail::node*, YAML::detail::node*> j) {
                      return (j.first->is(key));
                    });
 
-  if (it != m_map.end()) {
-    m_map.erase(it);
+  if (it != data.pairs.end()) {
+    data.pairs.erase(it);
+    reset_key_index();
     return true;
   }
 
   return false;
 }
 
+void node_data::reset_key_index() { map().pIndex.reset(); }
+
+node_data::node_map::const_iterator node_data::find_text_key(
+    std::string_view key, const std::size_t* pHash, bool ignoreCase,
+    const shared_memory_holder& pMemory) const {
+  const map_data& data = map();
+  if (data.pairs.size() < KEY_INDEX_THRESHOLD) {
+    return std::find_if(
+        data.pairs.begin(), data.pairs.end(),
+        [&](const kv_pair& m) { return key_matches(*m.first, key, ignoreCase); });
+  }
+
+  // the keys of frozen maps can not change, so their index stays valid
+  if (m_isFrozen) {
+    if (!data.pIndex)
+      build_key_index(nullptr);
+  } else {
+    key_revision& revision = pMemory->get_key_revision();
+    if (!has_current_key_index(revision))
+      build_key_index(&revision);
+  }
+
+  // the first match wins, like in the linear search
+  std::size_t position = data.pairs.size();
+  auto range =
+      data.pIndex->positions.equal_range(pHash ? *pHash : hash_key(key));
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second < position &&
+        key_matches(*data.pairs[it->second].first, key, ignoreCase))
+      position = it->second;
+  }
+  return data.pairs.begin() + position;
+}
+
+void node_data::build_key_index(key_revision* pRevision) const {
+  const map_data& data = map();
+  data.pIndex.reset(
+      new key_index{pRevision, pRevision ? pRevision->value : 0, {}});
+  data.pIndex->positions.reserve(data.pairs.size());
+
+  for (std::size_t i = 0; i < data.pairs.size(); i++) {
+    const node& k = *data.pairs[i].first;
+    // frozen keys never change, and other threads may read them
+    if (pRevision && !k.is_frozen())
+      k.mark_indexed_key(pRevision);
+    if (k.type() == NodeType::Scalar)
+      data.pIndex->positions.emplace(hash_key(k.scalar()), i);
+  }
+}
+
+// An index built for another memory, e.g. before this one was merged into it,
+// may miss changes to keys that point to the key revision of that memory
+bool node_data::has_current_key_index(const key_revision& revision) const {
+  const key_index* pIndex = map().pIndex.get();
+  return pIndex && pIndex->pRevision == &revision &&
+         pIndex->revision == revision.value;
+}
+
 void node_data::reset_sequence() {
-  m_sequence.clear();
-  m_seqSize = 0;
+  m_payload = std::make_unique<sequence_data>();
 }
 
-void node_data::reset_map() {
-  m_map.clear();
-  m_undefinedPairs.clear();
+void node_data::reset_map() { m_payload = std::make_unique<map_data>(); }
+
+node_data::sequence_data& node_data::make_sequence() {
+  if (m_type != NodeType::Sequence)
+    reset_sequence();
+  return sequence();
 }
 
-void node_data::insert_map_pair(node& key, node& value) {
-  m_map.emplace_back(&key, &value);
+void node_data::insert_map_pair(node& key, node& value,
+                                const shared_memory_holder& pMemory) {
+  map_data& data = map();
+  data.pairs.emplace_back(&key, &value);
+
+  key_revision* pRevision =
+      data.pIndex ? &pMemory->get_key_revision() : nullptr;
+  if (pRevision && has_current_key_index(*pRevision)) {
+    if (!key.is_frozen())
+      key.mark_indexed_key(pRevision);
+    if (key.type() == NodeType::Scalar) {
+      data.pIndex->positions.emplace(hash_key(key.scalar()),
+                                     data.pairs.size() - 1);
+    }
+  } else {
+    reset_key_index();
+  }
 
   if (!key.is_defined() || !value.is_defined())
-    m_undefinedPairs.emplace_back(&key, &value);
+    data.undefinedPairs.emplace_back(&key, &value);
 }
 
 void node_data::convert_to_map(const shared_memory_holder& pMemory) {
@@ -306,18 +592,21 @@ void node_data::convert_to_map(const shared_memory_holder& pMemory) {
 
 void node_data::convert_sequence_to_map(const shared_memory_holder& pMemory) {
   assert(m_type == NodeType::Sequence);
+  // the elements can no longer be reached by their index
+  pMemory->mark_modified();
 
+  const std::unique_ptr<sequence_data> pSequence =
+      std::move(std::get<std::unique_ptr<sequence_data>>(m_payload));
   reset_map();
-  for (std::size_t i = 0; i < m_sequence.size(); i++) {
+  for (std::size_t i = 0; i < pSequence->nodes.size(); i++) {
     std::stringstream stream;
     stream << i;
 
     node& key = pMemory->create_node();
     key.set_scalar(stream.str());
-    insert_map_pair(key, *m_sequence[i]);
+    insert_map_pair(key, *pSequence->nodes[i], pMemory);
   }
 
-  reset_sequence();
   m_type = NodeType::Map;
 }
 }  // namespace detail
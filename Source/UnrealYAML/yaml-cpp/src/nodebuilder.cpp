@@ -11,7 +11,7 @@ namespace YAML {
 struct Mark;
 
 NodeBuilder::NodeBuilder()
-    : m_pMemory(new detail::memory_holder),
+    : m_pMemory(new detail::memory_holder(true)),
       m_pRoot(nullptr),
       m_stack{},
       m_anchors{},
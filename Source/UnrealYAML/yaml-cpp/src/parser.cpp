@@ -16,6 +16,10 @@ Parser::Parser() : m_pScanner{}, m_pDirectives{} {}
 
 Parser::Parser(std::istream& in) : Parser() { Load(in); }
 
+Parser::Parser(const char* input, std::size_t size) : Parser() {
+  Load(input, size);
+}
+
 Parser::~Parser() = default;
 
 Parser::operator bool() const { return m_pScanner && !m_pScanner->empty(); }
@@ -25,6 +29,11 @@ void Parser::Load(std::istream& in) {
   m_pDirectives.reset(new Directives);
 }
 
+void Parser::Load(const char* input, std::size_t size) {
+  m_pScanner.reset(new Scanner(input, size));
+  m_pDirectives.reset(new Directives);
+}
+
 bool Parser::HandleNextDocument(EventHandler& eventHandler) {
   if (!m_pScanner)
     return false;
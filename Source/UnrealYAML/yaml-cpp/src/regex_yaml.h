@@ -30,10 +30,14 @@ enum REGEX_OP {
 // . Only matches from start of string
 class YAML_CPP_API RegEx {
  public:
+  // A hand-written matcher for Stream input, equivalent to the expression
+  using StreamMatcher = int (*)(const Stream&);
+
   RegEx();
   explicit RegEx(char ch);
   RegEx(char a, char z);
   RegEx(const std::string& str, REGEX_OP op = REGEX_SEQ);
+  RegEx(const RegEx& ex, StreamMatcher matcher);
   ~RegEx() = default;
 
   friend YAML_CPP_API RegEx operator!(const RegEx& ex);
@@ -80,6 +84,7 @@ class YAML_CPP_API RegEx {
   char m_a{};
   char m_z{};
   std::vector<RegEx> m_params;
+  StreamMatcher m_streamMatcher{};
 };
 }  // namespace YAML
 
@@ -43,6 +43,9 @@ inline int RegEx::Match(const std::string& str) const {
 }
 
 inline int RegEx::Match(const Stream& in) const {
+  if (m_streamMatcher)
+    return m_streamMatcher(in);
+
   StreamCharSource source(in);
   return Match(source);
 }
@@ -11,6 +11,20 @@ namespace YAML {
 Scanner::Scanner(std::istream& in)
     : INPUT(in),
       m_tokens{},
+      m_scratch{},
+      m_startedStream(false),
+      m_endedStream(false),
+      m_simpleKeyAllowed(false),
+      m_canBeJSONFlow(false),
+      m_simpleKeys{},
+      m_indents{},
+      m_indentRefs{},
+      m_flows{} {}
+
+Scanner::Scanner(const char* input, std::size_t size)
+    : INPUT(input, size),
+      m_tokens{},
+      m_scratch{},
       m_startedStream(false),
       m_endedStream(false),
       m_simpleKeyAllowed(false),
@@ -185,20 +199,20 @@ void Scanner::ScanToNextToken() {
     }
 
     // then eat a comment
-    if (Exp::Comment().Matches(INPUT)) {
+    if (Exp::MatchComment(INPUT) >= 0) {
       // eat until line break
-      while (INPUT && !Exp::Break().Matches(INPUT)) {
+      while (INPUT && Exp::MatchBreak(INPUT) < 0) {
         INPUT.eat(1);
       }
     }
 
     // if it's NOT a line break, then we're done!
-    if (!Exp::Break().Matches(INPUT)) {
+    int n = Exp::MatchBreak(INPUT);
+    if (n < 0) {
       break;
     }
 
     // otherwise, let's eat the line break and keep going
-    int n = Exp::Break().Match(INPUT);
     INPUT.eat(n);
 
     // oh yeah, and let's get rid of that simple key
@@ -266,8 +280,7 @@ void Scanner::EndStream() {
 }
 
 Token* Scanner::PushToken(Token::TYPE type) {
-  m_tokens.push(Token(type, INPUT.mark()));
-  return &m_tokens.back();
+  return &m_tokens.push(type, INPUT.mark());
 }
 
 Token::TYPE Scanner::GetStartTokenFor(IndentMarker::INDENT_TYPE type) const {
@@ -368,9 +381,9 @@ void Scanner::PopIndent() {
   }
 
   if (indent.type == IndentMarker::SEQ) {
-    m_tokens.push(Token(Token::BLOCK_SEQ_END, INPUT.mark()));
+    m_tokens.push(Token::BLOCK_SEQ_END, INPUT.mark());
   } else if (indent.type == IndentMarker::MAP) {
-    m_tokens.push(Token(Token::BLOCK_MAP_END, INPUT.mark()));
+    m_tokens.push(Token::BLOCK_MAP_END, INPUT.mark());
   }
 }
 
@@ -10,7 +10,6 @@
 #include <cstddef>
 #include <ios>
 #include <map>
-#include <queue>
 #include <set>
 #include <stack>
 #include <string>
@@ -18,6 +17,7 @@
 #include "ptr_vector.h"
 #include "stream.h"
 #include "token.h"
+#include "tokenqueue.h"
 #include "mark.h"
 
 namespace YAML {
@@ -30,6 +30,7 @@ class RegEx;
 class Scanner {
  public:
   explicit Scanner(std::istream &in);
+  Scanner(const char *input, std::size_t size);
   ~Scanner();
 
   /** Returns true if there are no more tokens to be read. */
@@ -174,7 +175,11 @@ class Scanner {
   Stream INPUT;
 
   // the output (tokens)
-  std::queue<Token> m_tokens;
+  TokenQueue m_tokens;
+
+  // scalars and anchors are scanned into this buffer and then swapped with
+  // the (recycled) value of their token, so neither side reallocates
+  std::string m_scratch;
 
   // state info
   bool m_startedStream, m_endedStream;
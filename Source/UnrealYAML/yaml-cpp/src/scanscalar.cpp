@@ -2,12 +2,111 @@
 
 #include <algorithm>
 
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define YAML_SCAN_SSE2 1
+#endif
+
 #include "exp.h"
 #include "regeximpl.h"
 #include "stream.h"
 #include "exceptions.h"  // IWYU pragma: keep
 
 namespace YAML {
+namespace {
+// Every character that can start any of the end conditions, line breaks,
+// escapes or the end of input that ScanScalar reacts to. Everything else can
+// be copied in bulk. Blanks are only relevant in front of a comment, which is
+// handled by stopping at the '#'.
+const char kStopChars[] = "\n\r\\\'\"#:,?[]{}\x04";
+
+struct StopTable {
+  bool stop[256];
+
+  StopTable() : stop{} {
+    stop[0] = true;  // a zero 'escape' means "no escape", but still matches
+    for (const char* ch = kStopChars; *ch; ++ch) {
+      stop[static_cast<unsigned char>(*ch)] = true;
+    }
+  }
+};
+
+const StopTable& Stops() {
+  static const StopTable table;
+  return table;
+}
+
+// Returns the number of characters in [str, str + size) before the first stop
+// character.
+std::size_t FindStop(const char* str, std::size_t size) {
+  std::size_t i = 0;
+
+#ifdef YAML_SCAN_SSE2
+  const std::size_t nStops = sizeof(kStopChars) - 1;
+  __m128i stops[nStops + 1];
+  for (std::size_t k = 0; k < nStops; ++k) {
+    stops[k] = _mm_set1_epi8(kStopChars[k]);
+  }
+  stops[nStops] = _mm_setzero_si128();
+
+  for (; i + 16 <= size; i += 16) {
+    const __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+    __m128i hits = _mm_cmpeq_epi8(block, stops[0]);
+    for (std::size_t k = 1; k <= nStops; ++k) {
+      hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, stops[k]));
+    }
+
+    const int mask = _mm_movemask_epi8(hits);
+    if (mask != 0) {
+      int bit = 0;
+      while (!(mask & (1 << bit))) {
+        ++bit;
+      }
+      return i + static_cast<std::size_t>(bit);
+    }
+  }
+#endif
+
+  const StopTable& table = Stops();
+  for (; i < size; ++i) {
+    if (table.stop[static_cast<unsigned char>(str[i])]) {
+      break;
+    }
+  }
+  return i;
+}
+
+bool IsBlank(char ch) { return ch == ' ' || ch == '\t'; }
+
+// Copies the run of ordinary characters at the current position of a
+// contiguous stream into the scalar, so the regular per-character loop only
+// has to deal with the boundaries.
+void AppendOrdinaryRun(Stream& INPUT, std::string& scalar,
+                       std::size_t& lastNonWhitespaceChar) {
+  const char* str = INPUT.Current();
+  std::size_t n = FindStop(str, INPUT.Remaining());
+
+  // a blank in front of a comment might end the scalar
+  if (n > 0 && n < INPUT.Remaining() && str[n] == '#' && IsBlank(str[n - 1])) {
+    --n;
+  }
+  if (n == 0) {
+    return;
+  }
+
+  scalar.append(str, n);
+  for (std::size_t i = n; i > 0; --i) {
+    if (!IsBlank(str[i - 1])) {
+      lastNonWhitespaceChar = scalar.size() - (n - i);
+      break;
+    }
+  }
+  INPUT.EatInLine(n);
+}
+}  // namespace
+
 // ScanScalar
 // . This is where the scalar magic happens.
 //
@@ -18,14 +117,14 @@ namespace YAML {
 //
 // . Depending on the parameters given, we store or stop
 //   and different places in the above flow.
-std::string ScanScalar(Stream& INPUT, ScanScalarParams& params) {
+void ScanScalar(Stream& INPUT, ScanScalarParams& params, std::string& scalar) {
   bool foundNonEmptyLine = false;
   bool pastOpeningBreak = (params.fold == FOLD_FLOW);
   bool emptyLine = false, moreIndented = false;
   int foldedNewlineCount = 0;
   bool foldedNewlineStartedMoreIndented = false;
   std::size_t lastEscapedChar = std::string::npos;
-  std::string scalar;
+  scalar.clear();
   params.leadingSpaces = false;
 
   if (!params.end) {
@@ -38,13 +137,13 @@ std::string ScanScalar(Stream& INPUT, ScanScalarParams& params) {
 
     std::size_t lastNonWhitespaceChar = scalar.size();
     bool escapedNewline = false;
-    while (!params.end->Matches(INPUT) && !Exp::Break().Matches(INPUT)) {
+    while (!params.end->Matches(INPUT) && Exp::MatchBreak(INPUT) < 0) {
       if (!INPUT) {
         break;
       }
 
       // document indicator?
-      if (INPUT.column() == 0 && Exp::DocIndicator().Matches(INPUT)) {
+      if (INPUT.column() == 0 && Exp::MatchDocIndicator(INPUT) >= 0) {
         if (params.onDocIndicator == BREAK) {
           break;
         }
@@ -57,7 +156,7 @@ std::string ScanScalar(Stream& INPUT, ScanScalarParams& params) {
       pastOpeningBreak = true;
 
       // escaped newline? (only if we're escaping on slash)
-      if (params.escape == '\\' && Exp::EscBreak().Matches(INPUT)) {
+      if (params.escape == '\\' && Exp::MatchEscBreak(INPUT) >= 0) {
         // eat escape character and get out (but preserve trailing whitespace!)
         INPUT.get();
         lastNonWhitespaceChar = scalar.size();
@@ -80,6 +179,12 @@ std::string ScanScalar(Stream& INPUT, ScanScalarParams& params) {
       if (ch != ' ' && ch != '\t') {
         lastNonWhitespaceChar = scalar.size();
       }
+
+      // and all the boring ones after it (we're past column 0 now, so there's
+      // no document indicator to look out for)
+      if (INPUT.IsContiguous()) {
+        AppendOrdinaryRun(INPUT, scalar, lastNonWhitespaceChar);
+      }
     }
 
     // eof? if we're looking to eat something, then we throw
@@ -111,7 +216,7 @@ std::string ScanScalar(Stream& INPUT, ScanScalarParams& params) {
 
     // ********************************
     // Phase #2: eat line ending
-    n = Exp::Break().Match(INPUT);
+    n = Exp::MatchBreak(INPUT);
     INPUT.eat(n);
 
     // ********************************
@@ -131,7 +236,7 @@ std::string ScanScalar(Stream& INPUT, ScanScalarParams& params) {
     }
 
     // and then the rest of the whitespace
-    while (Exp::Blank().Matches(INPUT)) {
+    while (Exp::MatchBlank(INPUT) >= 0) {
       // we check for tabs that masquerade as indentation
       if (INPUT.peek() == '\t' && INPUT.column() < params.indent &&
           params.onTabInIndentation == THROW) {
@@ -150,8 +255,8 @@ std::string ScanScalar(Stream& INPUT, ScanScalarParams& params) {
     }
 
     // was this an empty line?
-    bool nextEmptyLine = Exp::Break().Matches(INPUT);
-    bool nextMoreIndented = Exp::Blank().Matches(INPUT);
+    bool nextEmptyLine = Exp::MatchBreak(INPUT) >= 0;
+    bool nextMoreIndented = Exp::MatchBlank(INPUT) >= 0;
     if (params.fold == FOLD_BLOCK && foldedNewlineCount == 0 && nextEmptyLine)
       foldedNewlineStartedMoreIndented = moreIndented;
 
@@ -173,7 +278,7 @@ std::string ScanScalar(Stream& INPUT, ScanScalarParams& params) {
           }
 
           if (!nextEmptyLine && foldedNewlineCount > 0) {
-            scalar += std::string(foldedNewlineCount - 1, '\n');
+            scalar.append(foldedNewlineCount - 1, '\n');
             if (foldedNewlineStartedMoreIndented ||
                 nextMoreIndented | !foundNonEmptyLine) {
               scalar += "\n";
@@ -245,7 +350,5 @@ std::string ScanScalar(Stream& INPUT, ScanScalarParams& params) {
     default:
       break;
   }
-
-  return scalar;
 }
 }  // namespace YAML
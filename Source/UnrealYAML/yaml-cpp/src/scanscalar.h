@@ -57,7 +57,9 @@ struct ScanScalarParams {
   bool leadingSpaces;
 };
 
-std::string ScanScalar(Stream& INPUT, ScanScalarParams& params);
+// Scans into the given string (replacing its contents), so callers can reuse
+// its capacity.
+void ScanScalar(Stream& INPUT, ScanScalarParams& params, std::string& scalar);
 }
 
 #endif  // SCANSCALAR_H_62B23520_7C8E_11DE_8A39_0800200C9A66
@@ -51,10 +51,10 @@ void Scanner::ScanDirective() {
     while (INPUT && !Exp::BlankOrBreak().Matches(INPUT))
       param += INPUT.get();
 
-    token.params.push_back(param);
+    token.params.push_back(std::move(param));
   }
 
-  m_tokens.push(token);
+  m_tokens.push(std::move(token));
 }
 
 // DocStart
@@ -67,7 +67,7 @@ void Scanner::ScanDocStart() {
   // eat
   Mark mark = INPUT.mark();
   INPUT.eat(3);
-  m_tokens.push(Token(Token::DOC_START, mark));
+  m_tokens.push(Token::DOC_START, mark);
 }
 
 // DocEnd
@@ -80,7 +80,7 @@ void Scanner::ScanDocEnd() {
   // eat
   Mark mark = INPUT.mark();
   INPUT.eat(3);
-  m_tokens.push(Token(Token::DOC_END, mark));
+  m_tokens.push(Token::DOC_END, mark);
 }
 
 // FlowStart
@@ -97,7 +97,7 @@ void Scanner::ScanFlowStart() {
   m_flows.push(flowType);
   Token::TYPE type =
       (flowType == FLOW_SEQ ? Token::FLOW_SEQ_START : Token::FLOW_MAP_START);
-  m_tokens.push(Token(type, mark));
+  m_tokens.push(type, mark);
 }
 
 // FlowEnd
@@ -108,7 +108,7 @@ void Scanner::ScanFlowEnd() {
   // we might have a solo entry in the flow context
   if (InFlowContext()) {
     if (m_flows.top() == FLOW_MAP && VerifySimpleKey())
-      m_tokens.push(Token(Token::VALUE, INPUT.mark()));
+      m_tokens.push(Token::VALUE, INPUT.mark());
     else if (m_flows.top() == FLOW_SEQ)
       InvalidateSimpleKey();
   }
@@ -127,7 +127,7 @@ void Scanner::ScanFlowEnd() {
   m_flows.pop();
 
   Token::TYPE type = (flowType ? Token::FLOW_SEQ_END : Token::FLOW_MAP_END);
-  m_tokens.push(Token(type, mark));
+  m_tokens.push(type, mark);
 }
 
 // FlowEntry
@@ -135,7 +135,7 @@ void Scanner::ScanFlowEntry() {
   // we might have a solo entry in the flow context
   if (InFlowContext()) {
     if (m_flows.top() == FLOW_MAP && VerifySimpleKey())
-      m_tokens.push(Token(Token::VALUE, INPUT.mark()));
+      m_tokens.push(Token::VALUE, INPUT.mark());
     else if (m_flows.top() == FLOW_SEQ)
       InvalidateSimpleKey();
   }
@@ -146,7 +146,7 @@ void Scanner::ScanFlowEntry() {
   // eat
   Mark mark = INPUT.mark();
   INPUT.eat(1);
-  m_tokens.push(Token(Token::FLOW_ENTRY, mark));
+  m_tokens.push(Token::FLOW_ENTRY, mark);
 }
 
 // BlockEntry
@@ -166,7 +166,7 @@ void Scanner::ScanBlockEntry() {
   // eat
   Mark mark = INPUT.mark();
   INPUT.eat(1);
-  m_tokens.push(Token(Token::BLOCK_ENTRY, mark));
+  m_tokens.push(Token::BLOCK_ENTRY, mark);
 }
 
 // Key
@@ -185,7 +185,7 @@ void Scanner::ScanKey() {
   // eat
   Mark mark = INPUT.mark();
   INPUT.eat(1);
-  m_tokens.push(Token(Token::KEY, mark));
+  m_tokens.push(Token::KEY, mark);
 }
 
 // Value
@@ -214,13 +214,14 @@ void Scanner::ScanValue() {
   // eat
   Mark mark = INPUT.mark();
   INPUT.eat(1);
-  m_tokens.push(Token(Token::VALUE, mark));
+  m_tokens.push(Token::VALUE, mark);
 }
 
 // AnchorOrAlias
 void Scanner::ScanAnchorOrAlias() {
   bool alias;
-  std::string name;
+  std::string& name = m_scratch;
+  name.clear();
 
   // insert a potential simple key
   InsertPotentialSimpleKey();
@@ -247,9 +248,7 @@ void Scanner::ScanAnchorOrAlias() {
                                               : ErrorMsg::CHAR_IN_ANCHOR);
 
   // and we're done
-  Token token(alias ? Token::ALIAS : Token::ANCHOR, mark);
-  token.value = name;
-  m_tokens.push(token);
+  m_tokens.push(alias ? Token::ALIAS : Token::ANCHOR, mark).value.swap(name);
 }
 
 // Tag
@@ -288,13 +287,11 @@ void Scanner::ScanTag() {
     }
   }
 
-  m_tokens.push(token);
+  m_tokens.push(std::move(token));
 }
 
 // PlainScalar
 void Scanner::ScanPlainScalar() {
-  std::string scalar;
-
   // set up the scanning parameters
   ScanScalarParams params;
   params.end =
@@ -312,7 +309,7 @@ void Scanner::ScanPlainScalar() {
   InsertPotentialSimpleKey();
 
   Mark mark = INPUT.mark();
-  scalar = ScanScalar(INPUT, params);
+  ScanScalar(INPUT, params, m_scratch);
 
   // can have a simple key only if we ended the scalar by starting a new line
   m_simpleKeyAllowed = params.leadingSpaces;
@@ -322,15 +319,11 @@ void Scanner::ScanPlainScalar() {
   // if(Exp::IllegalCharInScalar.Matches(INPUT))
   //	throw ParserException(INPUT.mark(), ErrorMsg::CHAR_IN_SCALAR);
 
-  Token token(Token::PLAIN_SCALAR, mark);
-  token.value = scalar;
-  m_tokens.push(token);
+  m_tokens.push(Token::PLAIN_SCALAR, mark).value.swap(m_scratch);
 }
 
 // QuotedScalar
 void Scanner::ScanQuotedScalar() {
-  std::string scalar;
-
   // peek at single or double quote (don't eat because we need to preserve (for
   // the time being) the input position)
   char quote = INPUT.peek();
@@ -338,8 +331,9 @@ void Scanner::ScanQuotedScalar() {
 
   // setup the scanning parameters
   ScanScalarParams params;
-  RegEx end = (single ? RegEx(quote) & !Exp::EscSingleQuote() : RegEx(quote));
-  params.end = &end;
+  static const RegEx singleQuoteEnd = RegEx('\'') & !Exp::EscSingleQuote();
+  static const RegEx doubleQuoteEnd = RegEx('"');
+  params.end = (single ? &singleQuoteEnd : &doubleQuoteEnd);
   params.eatEnd = true;
   params.escape = (single ? '\'' : '\\');
   params.indent = 0;
@@ -358,13 +352,11 @@ void Scanner::ScanQuotedScalar() {
   INPUT.get();
 
   // and scan
-  scalar = ScanScalar(INPUT, params);
+  ScanScalar(INPUT, params, m_scratch);
   m_simpleKeyAllowed = false;
   m_canBeJSONFlow = true;
 
-  Token token(Token::NON_PLAIN_SCALAR, mark);
-  token.value = scalar;
-  m_tokens.push(token);
+  m_tokens.push(Token::NON_PLAIN_SCALAR, mark).value.swap(m_scratch);
 }
 
 // BlockScalarToken
@@ -373,8 +365,6 @@ void Scanner::ScanQuotedScalar() {
 // of the scalar),
 //   and then we need to figure out what level of indentation we'll be using.
 void Scanner::ScanBlockScalar() {
-  std::string scalar;
-
   ScanScalarParams params;
   params.indent = 1;
   params.detectIndent = true;
@@ -423,15 +413,13 @@ void Scanner::ScanBlockScalar() {
   params.trimTrailingSpaces = false;
   params.onTabInIndentation = THROW;
 
-  scalar = ScanScalar(INPUT, params);
+  ScanScalar(INPUT, params, m_scratch);
 
   // simple keys always ok after block scalars (since we're gonna start a new
   // line anyways)
   m_simpleKeyAllowed = true;
   m_canBeJSONFlow = false;
 
-  Token token(Token::NON_PLAIN_SCALAR, mark);
-  token.value = scalar;
-  m_tokens.push(token);
+  m_tokens.push(Token::NON_PLAIN_SCALAR, mark).value.swap(m_scratch);
 }
 }  // namespace YAML
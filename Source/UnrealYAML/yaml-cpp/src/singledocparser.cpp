@@ -172,12 +172,13 @@ void SingleDocParser::HandleBlockSequence(EventHandler& eventHandler) {
     if (m_scanner.empty())
       throw ParserException(m_scanner.mark(), ErrorMsg::END_OF_SEQ);
 
-    Token token = m_scanner.peek();
-    if (token.type != Token::BLOCK_ENTRY && token.type != Token::BLOCK_SEQ_END)
-      throw ParserException(token.mark, ErrorMsg::END_OF_SEQ);
+    // only keep what we need: the token's slot is reused once it is popped
+    const Token::TYPE type = m_scanner.peek().type;
+    if (type != Token::BLOCK_ENTRY && type != Token::BLOCK_SEQ_END)
+      throw ParserException(m_scanner.peek().mark, ErrorMsg::END_OF_SEQ);
 
     m_scanner.pop();
-    if (token.type == Token::BLOCK_SEQ_END)
+    if (type == Token::BLOCK_SEQ_END)
       break;
 
     // check for null
@@ -258,22 +259,24 @@ void SingleDocParser::HandleBlockMap(EventHandler& eventHandler) {
     if (m_scanner.empty())
       throw ParserException(m_scanner.mark(), ErrorMsg::END_OF_MAP);
 
-    Token token = m_scanner.peek();
-    if (token.type != Token::KEY && token.type != Token::VALUE &&
-        token.type != Token::BLOCK_MAP_END)
-      throw ParserException(token.mark, ErrorMsg::END_OF_MAP);
+    // only keep what we need: the token's slot is reused once it is popped
+    const Token::TYPE type = m_scanner.peek().type;
+    const Mark mark = m_scanner.peek().mark;
+    if (type != Token::KEY && type != Token::VALUE &&
+        type != Token::BLOCK_MAP_END)
+      throw ParserException(mark, ErrorMsg::END_OF_MAP);
 
-    if (token.type == Token::BLOCK_MAP_END) {
+    if (type == Token::BLOCK_MAP_END) {
       m_scanner.pop();
       break;
     }
 
     // grab key (if non-null)
-    if (token.type == Token::KEY) {
+    if (type == Token::KEY) {
       m_scanner.pop();
       HandleNode(eventHandler);
     } else {
-      eventHandler.OnNull(token.mark, NullAnchor);
+      eventHandler.OnNull(mark, NullAnchor);
     }
 
     // now grab value (optional)
@@ -281,7 +284,7 @@ void SingleDocParser::HandleBlockMap(EventHandler& eventHandler) {
       m_scanner.pop();
       HandleNode(eventHandler);
     } else {
-      eventHandler.OnNull(token.mark, NullAnchor);
+      eventHandler.OnNull(mark, NullAnchor);
     }
   }
 
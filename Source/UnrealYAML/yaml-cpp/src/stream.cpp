@@ -1,6 +1,7 @@
 #include "stream.h"
 
 #include <iostream>
+#include <sstream>
 
 #ifndef YAML_PREFETCH_SIZE
 #define YAML_PREFETCH_SIZE 2048
@@ -183,8 +184,11 @@ inline void QueueUnicodeCodepoint(std::deque<char>& q, unsigned long ch) {
 }
 
 Stream::Stream(std::istream& input)
-    : m_input(input),
+    : m_pInput(&input),
       m_mark{},
+      m_transcoded{},
+      m_pCurrent(nullptr),
+      m_pEnd(nullptr),
       m_charSet{},
       m_readahead{},
       m_pPrefetched(new unsigned char[YAML_PREFETCH_SIZE]),
@@ -240,9 +244,69 @@ Stream::Stream(std::istream& input)
   ReadAheadTo(0);
 }
 
+Stream::Stream(const char* input, std::size_t size)
+    : m_pInput(nullptr),
+      m_mark{},
+      m_transcoded{},
+      m_pCurrent(input),
+      m_pEnd(input + size),
+      m_charSet(utf8),
+      m_readahead{},
+      m_pPrefetched(nullptr),
+      m_nPrefetchedAvailable(0),
+      m_nPrefetchedUsed(0) {
+  using char_traits = std::istream::traits_type;
+
+  // Same BOM detection as above, but on the buffer itself
+  char_traits::int_type intro[4]{};
+  int nIntroUsed = 0;
+  std::size_t nConsumed = 0;
+  UtfIntroState state = uis_start;
+  for (; !s_introFinalState[state];) {
+    char_traits::int_type ch =
+        nConsumed < size
+            ? static_cast<unsigned char>(input[nConsumed++])
+            : char_traits::eof();
+    intro[nIntroUsed++] = ch;
+    UtfIntroCharType charType = IntroCharTypeOf(ch);
+    UtfIntroState newState = s_introTransitions[state][charType];
+    int nUngets = s_introUngetCount[state][charType];
+    for (; nUngets > 0; --nUngets) {
+      if (char_traits::eof() != intro[--nIntroUsed])
+        --nConsumed;
+    }
+    state = newState;
+  }
+
+  switch (state) {
+    case uis_utf16le:
+    case uis_utf16be:
+    case uis_utf32le:
+    case uis_utf32be:
+      break;
+    default:
+      // UTF-8: read straight from the buffer, skipping the BOM (if any)
+      m_pCurrent += nConsumed;
+      return;
+  }
+
+  // Anything else gets decoded once through the regular stream path
+  std::istringstream encoded(std::string(input, size));
+  Stream decoded(encoded);
+  while (decoded) {
+    m_transcoded += decoded.get();
+  }
+  m_pCurrent = m_transcoded.data();
+  m_pEnd = m_pCurrent + m_transcoded.size();
+}
+
 Stream::~Stream() { delete[] m_pPrefetched; }
 
 char Stream::peek() const {
+  if (IsContiguous()) {
+    return m_pCurrent < m_pEnd ? *m_pCurrent : Stream::eof();
+  }
+
   if (m_readahead.empty()) {
     return Stream::eof();
   }
@@ -251,7 +315,11 @@ char Stream::peek() const {
 }
 
 Stream::operator bool() const {
-  return m_input.good() ||
+  if (IsContiguous()) {
+    return m_pCurrent < m_pEnd;
+  }
+
+  return m_pInput->good() ||
          (!m_readahead.empty() && m_readahead[0] != Stream::eof());
 }
 
@@ -290,6 +358,15 @@ void Stream::eat(int n) {
 }
 
 void Stream::AdvanceCurrent() {
+  if (IsContiguous()) {
+    // like the stream version, keep counting once we're past the end
+    if (m_pCurrent < m_pEnd) {
+      ++m_pCurrent;
+    }
+    m_mark.pos++;
+    return;
+  }
+
   if (!m_readahead.empty()) {
     m_readahead.pop_front();
     m_mark.pos++;
@@ -299,7 +376,7 @@ void Stream::AdvanceCurrent() {
 }
 
 bool Stream::_ReadAheadTo(size_t i) const {
-  while (m_input.good() && (m_readahead.size() <= i)) {
+  while (m_pInput->good() && (m_readahead.size() <= i)) {
     switch (m_charSet) {
       case utf8:
         StreamInUtf8();
@@ -320,7 +397,7 @@ bool Stream::_ReadAheadTo(size_t i) const {
   }
 
   // signal end of stream
-  if (!m_input.good())
+  if (!m_pInput->good())
     m_readahead.push_back(Stream::eof());
 
   return m_readahead.size() > i;
@@ -328,7 +405,7 @@ bool Stream::_ReadAheadTo(size_t i) const {
 
 void Stream::StreamInUtf8() const {
   unsigned char b = GetNextByte();
-  if (m_input.good()) {
+  if (m_pInput->good()) {
     m_readahead.push_back(static_cast<char>(b));
   }
 }
@@ -340,7 +417,7 @@ void Stream::StreamInUtf16() const {
 
   bytes[0] = GetNextByte();
   bytes[1] = GetNextByte();
-  if (!m_input.good()) {
+  if (!m_pInput->good()) {
     return;
   }
   ch = (static_cast<unsigned long>(bytes[nBigEnd]) << 8) |
@@ -361,7 +438,7 @@ void Stream::StreamInUtf16() const {
     for (;;) {
       bytes[0] = GetNextByte();
       bytes[1] = GetNextByte();
-      if (!m_input.good()) {
+      if (!m_pInput->good()) {
         QueueUnicodeCodepoint(m_readahead, CP_REPLACEMENT_CHARACTER);
         return;
       }
@@ -405,12 +482,12 @@ inline char* ReadBuffer(unsigned char* pBuffer) {
 
 unsigned char Stream::GetNextByte() const {
   if (m_nPrefetchedUsed >= m_nPrefetchedAvailable) {
-    std::streambuf* pBuf = m_input.rdbuf();
+    std::streambuf* pBuf = m_pInput->rdbuf();
     m_nPrefetchedAvailable = static_cast<std::size_t>(
         pBuf->sgetn(ReadBuffer(m_pPrefetched), YAML_PREFETCH_SIZE));
     m_nPrefetchedUsed = 0;
     if (!m_nPrefetchedAvailable) {
-      m_input.setstate(std::ios_base::eofbit);
+      m_pInput->setstate(std::ios_base::eofbit);
     }
 
     if (0 == m_nPrefetchedAvailable) {
@@ -432,7 +509,7 @@ void Stream::StreamInUtf32() const {
   bytes[1] = GetNextByte();
   bytes[2] = GetNextByte();
   bytes[3] = GetNextByte();
-  if (!m_input.good()) {
+  if (!m_pInput->good()) {
     return;
   }
 
@@ -24,6 +24,14 @@ class Stream {
   friend class StreamCharSource;
 
   Stream(std::istream& input);
+
+  /**
+   * Constructs a stream that reads directly from a contiguous in-memory
+   * buffer. UTF-8 input is read in place without any intermediate copies;
+   * the buffer must outlive the stream. Other encodings are transcoded to
+   * UTF-8 once, up front.
+   */
+  Stream(const char* input, std::size_t size);
   Stream(const Stream&) = delete;
   Stream(Stream&&) = delete;
   Stream& operator=(const Stream&) = delete;
@@ -34,6 +42,7 @@ class Stream {
   bool operator!() const { return !static_cast<bool>(*this); }
 
   char peek() const;
+  char peek(std::size_t i) const;
   char get();
   std::string get(int n);
   void eat(int n = 1);
@@ -46,12 +55,32 @@ class Stream {
   int column() const { return m_mark.column; }
   void ResetColumn() { m_mark.column = 0; }
 
+  // Direct access to the remaining input of a contiguous stream
+  bool IsContiguous() const { return m_pInput == nullptr; }
+  const char* Current() const { return m_pCurrent; }
+  std::size_t Remaining() const {
+    return static_cast<std::size_t>(m_pEnd - m_pCurrent);
+  }
+
+  // . Eats 'n' characters of a contiguous stream, which must not contain a
+  //   line break
+  void EatInLine(std::size_t n) {
+    m_pCurrent += n;
+    m_mark.pos += static_cast<int>(n);
+    m_mark.column += static_cast<int>(n);
+  }
+
  private:
   enum CharacterSet { utf8, utf16le, utf16be, utf32le, utf32be };
 
-  std::istream& m_input;
+  std::istream* m_pInput;
   Mark m_mark;
 
+  // contiguous input (only used when constructed from a buffer)
+  std::string m_transcoded;
+  const char* m_pCurrent;
+  const char* m_pEnd;
+
   CharacterSet m_charSet;
   mutable std::deque<char> m_readahead;
   unsigned char* const m_pPrefetched;
@@ -70,13 +99,26 @@ class Stream {
 
 // CharAt
 // . Unchecked access
-inline char Stream::CharAt(size_t i) const { return m_readahead[i]; }
+inline char Stream::CharAt(size_t i) const {
+  if (IsContiguous())
+    return i < Remaining() ? m_pCurrent[i] : Stream::eof();
+  return m_readahead[i];
+}
 
 inline bool Stream::ReadAheadTo(size_t i) const {
+  // a contiguous buffer has everything available, followed by a single eof
+  if (IsContiguous())
+    return i <= Remaining();
   if (m_readahead.size() > i)
     return true;
   return _ReadAheadTo(i);
 }
+
+// peek
+// . Returns the character 'i' positions ahead, or eof() past the end
+inline char Stream::peek(std::size_t i) const {
+  return ReadAheadTo(i) ? CharAt(i) : Stream::eof();
+}
 }  // namespace YAML
 
 #endif  // STREAM_H_62B23520_7C8E_11DE_8A39_0800200C9A66
@@ -0,0 +1,123 @@
+#ifndef TOKENQUEUE_H_62B23520_7C8E_11DE_8A39_0800200C9A66
+#define TOKENQUEUE_H_62B23520_7C8E_11DE_8A39_0800200C9A66
+
+#if defined(_MSC_VER) ||                                            \
+    (defined(__GNUC__) && (__GNUC__ == 3 && __GNUC_MINOR__ >= 4) || \
+     (__GNUC__ >= 4))  // GCC supports "pragma once" correctly since 3.4
+#pragma once
+#endif
+
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include "mark.h"
+#include "token.h"
+
+namespace YAML {
+
+/**
+ * A FIFO of tokens that recycles its slots.
+ *
+ * Popped tokens are kept and handed out again by push(), so the strings they
+ * own keep their capacity and a warmed up queue scans without allocating.
+ * Tokens never move while they are queued, so the scanner can hold on to
+ * pointers of unverified tokens (simple keys, indent start tokens).
+ */
+class TokenQueue {
+ public:
+  TokenQueue() : m_storage{}, m_ring(kInitialCapacity), m_head(0), m_size(0) {}
+  TokenQueue(const TokenQueue&) = delete;
+  TokenQueue(TokenQueue&&) = default;
+  TokenQueue& operator=(const TokenQueue&) = delete;
+  TokenQueue& operator=(TokenQueue&&) = default;
+
+  bool empty() const { return m_size == 0; }
+  std::size_t size() const { return m_size; }
+
+  Token& front() {
+    assert(m_size > 0);
+    return *m_ring[m_head];
+  }
+  const Token& front() const {
+    assert(m_size > 0);
+    return *m_ring[m_head];
+  }
+  Token& back() {
+    assert(m_size > 0);
+    return *m_ring[(m_head + m_size - 1) & (m_ring.size() - 1)];
+  }
+
+  /**
+   * Enqueues a token, reusing a previously popped one if possible. The token is
+   * reset to the state of a freshly constructed Token(type, mark), but its
+   * strings keep their capacity.
+   */
+  Token& push(Token::TYPE type, const Mark& mark) {
+    if (m_size == m_ring.size()) {
+      Grow();
+    }
+
+    Token* token = m_ring[(m_head + m_size) & (m_ring.size() - 1)];
+    if (!token) {
+      m_storage.emplace_back(type, mark);
+      token = &m_storage.back();
+      m_ring[(m_head + m_size) & (m_ring.size() - 1)] = token;
+    } else {
+      token->status = Token::VALID;
+      token->type = type;
+      token->mark = mark;
+      token->value.clear();
+      token->params.clear();
+      token->data = 0;
+    }
+
+    m_size++;
+    return *token;
+  }
+
+  /** Enqueues a token that was built up front (e.g. directives and tags). */
+  Token& push(Token&& token) {
+    Token& queued = push(token.type, token.mark);
+    queued = std::move(token);
+    return queued;
+  }
+
+  /**
+   * Dequeues the front token. Its slot stays alive for reuse, so references to
+   * it must not be used after the next push().
+   */
+  void pop() {
+    assert(m_size > 0);
+    m_head = (m_head + 1) & (m_ring.size() - 1);
+    m_size--;
+  }
+
+ private:
+  static constexpr std::size_t kInitialCapacity = 16;
+
+  // Only called when every slot holds a queued token; unrolls them to the
+  // front of a ring twice the size.
+  void Grow() {
+    const std::size_t capacity = m_ring.size();
+    std::vector<Token*> ring(capacity * 2, nullptr);
+    for (std::size_t i = 0; i < capacity; i++) {
+      ring[i] = m_ring[(m_head + i) & (capacity - 1)];
+    }
+    m_ring.swap(ring);
+    m_head = 0;
+  }
+
+  // owns the tokens; a deque never moves its elements on emplace_back
+  std::deque<Token> m_storage;
+  // the queue itself, with a power of two size; nullptr marks a slot that has
+  // never been used
+  std::vector<Token*> m_ring;
+  std::size_t m_head;
+  std::size_t m_size;
+};
+}  // namespace YAML
+
+#endif  // TOKENQUEUE_H_62B23520_7C8E_11DE_8A39_0800200C9A66
@@ -1,12 +1,207 @@
 #include "node/node.h"
-#include "nodebuilder.h"
-#include "nodeevents.h"
+#include "exceptions.h"
+#include "node/detail/memory.h"
+#include "node/detail/node.h"
+#include "node/impl.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 namespace YAML {
+namespace {
+// The copies of the nodes seen so far, by their node_ref. It is an open
+// addressing table, so that remembering a node does not allocate.
+class copy_table {
+ public:
+  copy_table() : m_entries(64), m_size(0) {}
+
+  detail::node* find(const detail::node_ref* pRef) const {
+    for (std::size_t i = slot(pRef);; i = (i + 1) & (m_entries.size() - 1)) {
+      if (m_entries[i].first == pRef)
+        return m_entries[i].second;
+      if (!m_entries[i].first)
+        return nullptr;
+    }
+  }
+
+  // the node must not be in the table yet
+  void insert(const detail::node_ref* pRef, detail::node* pCopy) {
+    if (2 * (m_size + 1) > m_entries.size())
+      grow();
+
+    std::size_t i = slot(pRef);
+    while (m_entries[i].first)
+      i = (i + 1) & (m_entries.size() - 1);
+    m_entries[i] = {pRef, pCopy};
+    m_size++;
+  }
+
+ private:
+  using entry = std::pair<const detail::node_ref*, detail::node*>;
+
+  std::size_t slot(const detail::node_ref* pRef) const {
+    // Fibonacci hashing, the low bits of a pointer are mostly zero
+    const std::uint64_t hash =
+        reinterpret_cast<std::uintptr_t>(pRef) * 0x9E3779B97F4A7C15ull;
+    return static_cast<std::size_t>(hash >> 32) & (m_entries.size() - 1);
+  }
+
+  void grow() {
+    std::vector<entry> entries(m_entries.size() * 2);
+    entries.swap(m_entries);
+    m_size = 0;
+    for (const entry& e : entries) {
+      if (e.first)
+        insert(e.first, e.second);
+    }
+  }
+
+  std::vector<entry> m_entries;
+  std::size_t m_size;
+};
+
+// Copies a tree node by node into a new memory, which allocates them in bulk.
+//
+// A node that appears in several places is found by its node_ref. If aliases
+// are preserved, all copies are remembered, so it is copied once. Otherwise
+// only the collections that are being copied at the moment are, so each place
+// gets its own copy, but recursive structures still end.
+class node_copier {
+ public:
+  // thrown by copy() once more than maxNodes nodes were created
+  struct limit_reached {};
+
+  node_copier(detail::shared_memory_holder pMemory, bool preserveAliases,
+              std::size_t maxNodes = SIZE_MAX)
+      : m_pMemory(std::move(pMemory)),
+        m_preserveAliases(preserveAliases),
+        m_maxNodes(maxNodes),
+        m_created(0),
+        m_copies{},
+        m_open{} {}
+
+  detail::node& copy(const detail::node& source) {
+    if (detail::node* pCopy = find(source))
+      return *pCopy;
+
+    if (++m_created > m_maxNodes)
+      throw limit_reached();
+    detail::node& copy = m_pMemory->create_node();
+    if (m_preserveAliases)
+      m_copies.insert(source.ref(), &copy);
+
+    switch (source.type()) {
+      case NodeType::Undefined:
+        return copy;
+      case NodeType::Null:
+        copy.set_null();
+        break;
+      case NodeType::Scalar:
+        copy.set_scalar(source.scalar());
+        break;
+      case NodeType::Sequence:
+        copy.set_type(NodeType::Sequence);
+        copy.reserve(source.size());
+        m_open.emplace_back(source.ref(), &copy);
+        for (auto element : source)
+          copy.push_back(this->copy(*element), m_pMemory);
+        m_open.pop_back();
+        break;
+      case NodeType::Map:
+        copy.set_type(NodeType::Map);
+        copy.reserve(source.size());
+        m_open.emplace_back(source.ref(), &copy);
+        for (auto element : source) {
+          detail::node& key = this->copy(*element.first);
+          copy.insert(key, this->copy(*element.second), m_pMemory);
+        }
+        m_open.pop_back();
+        break;
+    }
+
+    copy.set_mark(source.mark());
+    copy.set_tag(source.tag());
+    copy.set_style(source.style());
+    return copy;
+  }
+
+ private:
+  using copy_entry = std::pair<const detail::node_ref*, detail::node*>;
+
+  detail::node* find(const detail::node& source) const {
+    if (m_preserveAliases)
+      return m_copies.find(source.ref());
+
+    for (const copy_entry& entry : m_open) {
+      if (entry.first == source.ref())
+        return entry.second;
+    }
+    return nullptr;
+  }
+
+  detail::shared_memory_holder m_pMemory;
+  bool m_preserveAliases;
+  std::size_t m_maxNodes;
+  std::size_t m_created;
+  copy_table m_copies;
+  std::vector<copy_entry> m_open;
+};
+
+// Aliases of aliases multiply the nodes of an unshared copy with every level,
+// up to billions for a small input. Past this many times the nodes of the
+// source memory, CloneUnshared() preserves the aliases instead.
+constexpr std::size_t UNSHARED_COPY_FACTOR = 16;
+constexpr std::size_t MIN_UNSHARED_COPY_LIMIT = 64 * 1024;
+}  // namespace
+
 Node Clone(const Node& node) {
-  NodeEvents events(node);
-  NodeBuilder builder;
-  events.Emit(builder);
-  return builder.Root();
+  if (!node.m_pNode || !node.m_pNode->is_defined())
+    return Node();
+
+  detail::shared_memory_holder pMemory(new detail::memory_holder(true));
+  node_copier copier(pMemory, true);
+  return Node(copier.copy(*node.m_pNode), pMemory);
+}
+
+Node CloneUnshared(const Node& node) {
+  if (!node.m_pNode || !node.m_pNode->is_defined())
+    return Node();
+
+  const std::size_t maxNodes = std::max(
+      MIN_UNSHARED_COPY_LIMIT, UNSHARED_COPY_FACTOR * node.m_pMemory->size());
+  try {
+    detail::shared_memory_holder pMemory(new detail::memory_holder(true));
+    node_copier copier(pMemory, false, maxNodes);
+    return Node(copier.copy(*node.m_pNode), pMemory);
+  } catch (const node_copier::limit_reached&) {
+    return Clone(node);
+  }
+}
+
+Node Freeze(const Node& node) {
+  if (!node.m_isValid)
+    throw InvalidNode(node.m_invalidKey);
+
+  // the copy has no undefined nodes, so nothing is left to be computed lazily
+  Node frozen = Clone(node);
+  if (!frozen.m_pNode) {
+    frozen.m_pMemory.reset(new detail::memory_holder);
+    frozen.m_pNode = &frozen.m_pMemory->create_node();
+  }
+
+  frozen.m_pNode->freeze();
+  frozen.m_pMemory->freeze();
+  return frozen;
+}
+
+MemoryStats GetMemoryStats(const Node& node) {
+  if (!node.m_isValid)
+    throw InvalidNode(node.m_invalidKey);
+
+  MemoryStats stats;
+  node.m_pMemory->add_stats(stats);
+  return stats;
 }
 }  // namespace YAML
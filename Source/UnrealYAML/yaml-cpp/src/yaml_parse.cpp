@@ -1,32 +1,230 @@
 #include "node/parse.h"
 
+#include <cstring>
+#include <exception>
 #include <fstream>
 #include <sstream>
 
+#include "eventhandler.h"
+#include "exceptions.h"
 #include "nodebuilder.h"
 #include "node/impl.h"
 #include "node/node.h"
 #include "parser.h"
 
 namespace YAML {
+namespace {
+Node LoadDocument(Parser& parser) {
+  NodeBuilder builder;
+  if (!parser.HandleNextDocument(builder)) {
+    return Node();
+  }
+
+  return builder.Root();
+}
+
+std::vector<Node> LoadDocuments(Parser& parser) {
+  std::vector<Node> docs;
+
+  while (true) {
+    NodeBuilder builder;
+    if (!parser.HandleNextDocument(builder)) {
+      break;
+    }
+    docs.push_back(builder.Root());
+  }
+
+  return docs;
+}
+
+// A run of whole documents inside the input
+struct DocumentRange {
+  std::size_t begin;
+  std::size_t end;
+  Mark mark;
+};
+
+// Documents are batched into ranges of at least this size, so the setup of a
+// parser does not dominate for small documents
+const std::size_t kMinRangeSize = 32 * 1024;
+
+// Splits the input into ranges of documents. A "---" or "..." at the start of
+// a line always ends the document before it, even inside a scalar. A range
+// only ends where the next document starts, so the "..." lines and comments
+// that follow a document stay with it. Returns false if the input cannot be
+// split safely.
+bool SplitDocuments(const char* input, std::size_t size,
+                    std::vector<DocumentRange>& documents) {
+  // UTF-16 and UTF-32 (with or without BOM) contain null bytes up front
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(input);
+  if (size >= 2 && ((bytes[0] == 0xFE && bytes[1] == 0xFF) ||
+                    (bytes[0] == 0xFF && bytes[1] == 0xFE)))
+    return false;
+  if (std::memchr(input, '\0', size < 4 ? size : 4))
+    return false;
+
+  // the stream does not count a UTF-8 BOM
+  const std::size_t bom =
+      (size >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF)
+          ? 3
+          : 0;
+
+  DocumentRange current{0, 0, Mark()};
+  bool documentOpen = false;
+  bool documentEnded = false;
+  std::size_t offset = 0;
+  int line = 0;
+
+  const auto close = [&](std::size_t end, int endLine) {
+    if (end - current.begin < kMinRangeSize)
+      return;
+
+    current.end = end;
+    documents.push_back(current);
+    current.begin = end;
+    current.mark.pos = static_cast<int>(end - bom);
+    current.mark.line = endLine;
+  };
+
+  while (offset < size) {
+    const char* start = input + offset;
+    const char* lineBreak =
+        static_cast<const char*>(std::memchr(start, '\n', size - offset));
+    std::size_t length = lineBreak ? lineBreak - start : size - offset;
+    const std::size_t next = offset + length + (lineBreak ? 1 : 0);
+    const int nextLine = lineBreak ? line + 1 : line;
+
+    if (offset == 0) {
+      start += bom;
+      length -= bom;
+    }
+
+    switch (ClassifyLine(start, length)) {
+      case LineKind::Directive:
+        return false;
+      case LineKind::DocumentStart:
+        if (documentOpen || documentEnded)
+          close(offset, line);
+        documentOpen = true;
+        documentEnded = false;
+        break;
+      case LineKind::DocumentEnd:
+        documentOpen = false;
+        documentEnded = true;
+        break;
+      case LineKind::Content:
+        if (documentEnded)
+          close(offset, line);
+        documentOpen = true;
+        documentEnded = false;
+        break;
+      case LineKind::Blank:
+        break;
+    }
+
+    line = nextLine;
+    offset = next;
+  }
+
+  if (current.begin < size) {
+    current.end = size;
+    documents.push_back(current);
+  }
+  return true;
+}
+
+// Moves a mark inside a document to its position inside the whole input
+Mark OffsetMark(Mark mark, const Mark& origin) {
+  if (!mark.is_null()) {
+    mark.pos += origin.pos;
+    mark.line += origin.line;
+  }
+  return mark;
+}
+
+// Forwards all events with their marks moved to the position of the document
+// inside the whole input
+class OffsetEventHandler : public EventHandler {
+ public:
+  OffsetEventHandler(EventHandler& handler, const Mark& origin)
+      : m_handler(handler), m_origin(origin) {}
+
+  void OnDocumentStart(const Mark& mark) override {
+    m_handler.OnDocumentStart(Offset(mark));
+  }
+  void OnDocumentEnd() override { m_handler.OnDocumentEnd(); }
+
+  void OnNull(const Mark& mark, anchor_t anchor) override {
+    m_handler.OnNull(Offset(mark), anchor);
+  }
+  void OnAlias(const Mark& mark, anchor_t anchor) override {
+    m_handler.OnAlias(Offset(mark), anchor);
+  }
+  void OnScalar(const Mark& mark, const std::string& tag, anchor_t anchor,
+                const std::string& value) override {
+    m_handler.OnScalar(Offset(mark), tag, anchor, value);
+  }
+
+  void OnSequenceStart(const Mark& mark, const std::string& tag,
+                       anchor_t anchor, EmitterStyle style) override {
+    m_handler.OnSequenceStart(Offset(mark), tag, anchor, style);
+  }
+  void OnSequenceEnd() override { m_handler.OnSequenceEnd(); }
+
+  void OnMapStart(const Mark& mark, const std::string& tag, anchor_t anchor,
+                  EmitterStyle style) override {
+    m_handler.OnMapStart(Offset(mark), tag, anchor, style);
+  }
+  void OnMapEnd() override { m_handler.OnMapEnd(); }
+
+  void OnAnchor(const Mark& mark, const std::string& anchor_name) override {
+    m_handler.OnAnchor(Offset(mark), anchor_name);
+  }
+
+ private:
+  Mark Offset(const Mark& mark) const { return OffsetMark(mark, m_origin); }
+
+  EventHandler& m_handler;
+  Mark m_origin;
+};
+}  // namespace
+
+LineKind ClassifyLine(const char* line, std::size_t length) {
+  const auto isMarker = [line, length](char indicator) {
+    return length >= 3 && line[0] == indicator && line[1] == indicator &&
+           line[2] == indicator &&
+           (length == 3 || line[3] == ' ' || line[3] == '\t' ||
+            line[3] == '\r');
+  };
+
+  if (isMarker('-'))
+    return LineKind::DocumentStart;
+  if (isMarker('.'))
+    return LineKind::DocumentEnd;
+  if (length > 0 && line[0] == '%')
+    return LineKind::Directive;
+
+  for (std::size_t i = 0; i < length; i++) {
+    if (line[i] != ' ' && line[i] != '\t' && line[i] != '\r')
+      return line[i] == '#' ? LineKind::Blank : LineKind::Content;
+  }
+  return LineKind::Blank;
+}
+
 Node Load(const std::string& input) {
-  std::stringstream stream(input);
-  return Load(stream);
+  return Load(input.data(), input.size());
 }
 
-Node Load(const char* input) {
-  std::stringstream stream(input);
-  return Load(stream);
+Node Load(const char* input) { return Load(input, std::strlen(input)); }
+
+Node Load(const char* input, std::size_t size) {
+  Parser parser(input, size);
+  return LoadDocument(parser);
 }
 
 Node Load(std::istream& input) {
   Parser parser(input);
-  NodeBuilder builder;
-  if (!parser.HandleNextDocument(builder)) {
-    return Node();
-  }
-
-  return builder.Root();
+  return LoadDocument(parser);
 }
 
 Node LoadFile(const std::string& filename) {
@@ -38,30 +236,71 @@ Node LoadFile(const std::string& filename) {
 }
 
 std::vector<Node> LoadAll(const std::string& input) {
-  std::stringstream stream(input);
-  return LoadAll(stream);
+  return LoadAll(input.data(), input.size());
 }
 
 std::vector<Node> LoadAll(const char* input) {
-  std::stringstream stream(input);
-  return LoadAll(stream);
+  return LoadAll(input, std::strlen(input));
 }
 
-std::vector<Node> LoadAll(std::istream& input) {
-  std::vector<Node> docs;
+std::vector<Node> LoadAll(const char* input, std::size_t size) {
+  Parser parser(input, size);
+  return LoadDocuments(parser);
+}
 
-  Parser parser(input);
-  while (true) {
-    NodeBuilder builder;
-    if (!parser.HandleNextDocument(builder)) {
-      break;
+std::vector<Node> LoadAll(const char* input, std::size_t size,
+                          const Mark& origin) {
+  try {
+    Parser parser(input, size);
+    std::vector<Node> docs;
+    while (true) {
+      NodeBuilder builder;
+      OffsetEventHandler handler(builder, origin);
+      if (!parser.HandleNextDocument(handler)) {
+        break;
+      }
+      docs.push_back(builder.Root());
     }
-    docs.push_back(builder.Root());
+    return docs;
+  } catch (const ParserException& e) {
+    throw ParserException(OffsetMark(e.mark, origin), e.msg);
+  }
+}
+
+std::vector<Node> LoadAll(const char* input, std::size_t size,
+                          const ParallelFor& parallelFor) {
+  std::vector<DocumentRange> ranges;
+  if (!SplitDocuments(input, size, ranges) || ranges.size() < 2) {
+    return LoadAll(input, size);
   }
 
+  std::vector<std::vector<Node>> results(ranges.size());
+  std::vector<std::exception_ptr> errors(ranges.size());
+  parallelFor(ranges.size(), [&](std::size_t i) {
+    const DocumentRange& range = ranges[i];
+    try {
+      results[i] =
+          LoadAll(input + range.begin, range.end - range.begin, range.mark);
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  });
+
+  std::vector<Node> docs;
+  for (std::size_t i = 0; i < ranges.size(); i++) {
+    if (errors[i]) {
+      std::rethrow_exception(errors[i]);
+    }
+    docs.insert(docs.end(), results[i].begin(), results[i].end());
+  }
   return docs;
 }
 
+std::vector<Node> LoadAll(std::istream& input) {
+  Parser parser(input);
+  return LoadDocuments(parser);
+}
+
 std::vector<Node> LoadAllFromFile(const std::string& filename) {
   std::ifstream fin(filename);
   if (!fin) {